@@ -0,0 +1,8 @@
+#pragma once
+
+#include "compact/Compaction.hpp"
+#include "compact/Remove.hpp"
+
+namespace dslab {
+    using namespace compact;
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "../vector.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace dslab::compact {
+
+// in-place stream compaction of contiguous arithmetic elements: keep some of the elements, in order, at the front
+// every kernel reads a block of W elements into a register, computes a bit mask of the elements to keep,
+// and writes them at once with a lane permutation looked up by the mask (AVX2, W = 8 for 4-byte and 4 for 8-byte types)
+// without AVX2, or for other element sizes, the elements are written one by one without branches:
+// each one is always stored at the output, and the output only advances if the element is kept
+// a kernel returns the new end, the elements after it are unspecified
+class Compaction {
+public:
+    template <typename T>
+    static constexpr bool supports { std::is_arithmetic_v<T> };
+
+    // keep the elements x with !pred(x)
+    template <typename T, typename P> requires supports<T>
+    static T* removeIf(T* first, T* last, P&& pred) {
+#ifdef DSLAB_VECTOR_FIND_SIMD
+        if constexpr (PERMUTABLE<T>) {
+            if (avx2()) {
+                return removeIfAVX2(first, last, pred);
+            }
+        }
+#endif
+        return removeIfScalar(first, first, last, pred);
+    }
+
+    // keep the elements x with !(x == e)
+    template <typename T> requires supports<T>
+    static T* remove(T* first, T* last, const T& e) {
+#ifdef DSLAB_VECTOR_FIND_SIMD
+        if constexpr (PERMUTABLE<T>) {
+            if (avx2()) {
+                return removeAVX2(first, last, e);
+            }
+        }
+#endif
+        auto pred { [e](const T& x) { return x == e; } };
+        return removeIfScalar(first, first, last, pred);
+    }
+
+    // keep the first element of every run of equal elements
+    template <typename T> requires supports<T>
+    static T* unique(T* first, T* last) {
+        if (first == last) {
+            return last;
+        }
+#ifdef DSLAB_VECTOR_FIND_SIMD
+        if constexpr (PERMUTABLE<T>) {
+            if (avx2()) {
+                return uniqueAVX2(first, last);
+            }
+        }
+#endif
+        return uniqueScalar(first + 1, first + 1, last, *first);
+    }
+
+private:
+    template <typename T>
+    static constexpr bool PERMUTABLE { sizeof(T) == 4 || sizeof(T) == 8 };
+
+    template <typename T, typename P>
+    static T* removeIfScalar(T* out, T* in, T* last, P& pred) {
+        for (; in != last; ++in) {
+            T x { *in };
+            *out = x;
+            out += !pred(x);
+        }
+        return out;
+    }
+
+    // prev is the element before in (as it was before the compaction)
+    template <typename T>
+    static T* uniqueScalar(T* out, T* in, T* last, T prev) {
+        for (; in != last; ++in) {
+            T x { *in };
+            *out = x;
+            out += !(x == prev);
+            prev = x;
+        }
+        return out;
+    }
+
+#ifdef DSLAB_VECTOR_FIND_SIMD
+    static bool avx2() {
+        static const bool supported { __builtin_cpu_supports("avx2") != 0 };
+        return supported;
+    }
+
+    // for every mask of W lanes, the 32-bit lane indices that move the kept lanes to the front
+    // a 64-bit lane is moved as a pair of 32-bit lanes
+    template <std::size_t W>
+    static constexpr auto PERMUTATIONS { [] {
+        std::array<std::array<std::uint32_t, 8>, 1uz << W> table {};
+        for (auto mask { 0uz }; mask < table.size(); ++mask) {
+            auto k { 0uz };
+            for (auto lane { 0uz }; lane < W; ++lane) {
+                if (mask >> lane & 1) {
+                    for (auto half { 0uz }; half < 8 / W; ++half) {
+                        table[mask][k++] = static_cast<std::uint32_t>(lane * (8 / W) + half);
+                    }
+                }
+            }
+            while (k < 8) {
+                table[mask][k++] = 0;
+            }
+        }
+        return table;
+    }() };
+
+    template <typename T>
+    static constexpr std::size_t W { 32 / sizeof(T) };
+
+    template <typename T>
+    [[gnu::target("avx2")]] static __m256i load(const T* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    template <typename T>
+    [[gnu::target("avx2")]] static __m256i broadcast(const T& e) {
+        T lanes[W<T>];
+        std::fill_n(lanes, W<T>, e);
+        return load(lanes);
+    }
+
+    // one bit per lane, set if the lanes of a and b are equal (by ==)
+    template <typename T>
+    [[gnu::target("avx2")]] static unsigned equal(__m256i a, __m256i b) {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+        } else {
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+        }
+    }
+
+    // write the lanes of v selected by keep at out, and return the new output position
+    // all W lanes are written, out must not be after the block v was read from
+    template <typename T>
+    [[gnu::target("avx2")]] static T* store(T* out, __m256i v, unsigned keep) {
+        auto index { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(PERMUTATIONS<W<T>>[keep].data())) };
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permutevar8x32_epi32(v, index));
+        return out + std::popcount(keep);
+    }
+
+    template <typename T, typename P>
+    [[gnu::target("avx2")]] static T* removeIfAVX2(T* first, T* last, P& pred) {
+        auto out { first }, in { first };
+        for (; static_cast<std::size_t>(last - in) >= W<T>; in += W<T>) {
+            auto keep { 0u };
+            for (auto lane { 0uz }; lane < W<T>; ++lane) {
+                keep |= static_cast<unsigned>(!pred(in[lane])) << lane;
+            }
+            out = store(out, load(in), keep);
+        }
+        return removeIfScalar(out, in, last, pred);
+    }
+
+    template <typename T>
+    [[gnu::target("avx2")]] static T* removeAVX2(T* first, T* last, const T& e) {
+        constexpr auto FULL { (1u << W<T>) - 1 };
+        auto key { broadcast(e) };
+        auto out { first }, in { first };
+        for (; static_cast<std::size_t>(last - in) >= W<T>; in += W<T>) {
+            auto v { load(in) };
+            out = store(out, v, ~equal<T>(v, key) & FULL);
+        }
+        auto pred { [e](const T& x) { return x == e; } };
+        return removeIfScalar(out, in, last, pred);
+    }
+
+    // each lane is compared with the lane before it, read one element back
+    // the element before the block may already be overwritten, so the first lane takes it from the previous block
+    template <typename T>
+    [[gnu::target("avx2")]] static T* uniqueAVX2(T* first, T* last) {
+        constexpr auto FULL { (1u << W<T>) - 1 };
+        constexpr int FIRST_LANE { sizeof(T) == 4 ? 0b1 : 0b11 };
+        T prev { *first };
+        auto out { first + 1 }, in { first + 1 };
+        for (; static_cast<std::size_t>(last - in) >= W<T>; in += W<T>) {
+            auto v { load(in) };
+            auto before { _mm256_blend_epi32(load(in - 1), broadcast(prev), FIRST_LANE) };
+            prev = in[W<T> - 1];
+            out = store(out, v, ~equal<T>(v, before) & FULL);
+        }
+        return uniqueScalar(out, in, last, prev);
+    }
+#endif
+};
+
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Compaction.hpp"
+#include <unordered_set>
+
+namespace dslab::compact {
+
+// erase-style algorithms on vectors: each one removes elements from V in a single pass, keeps the order of the rest,
+// and returns the number of elements removed
+// arithmetic elements go through Compaction, the others are moved with a fast and a slow pointer
+
+template <typename V>
+concept ContiguousVector = std::is_base_of_v<AbstractVector<typename V::value_type>, V>;
+
+// remove the elements x with pred(x)
+template <ContiguousVector V, typename P>
+std::size_t remove_if(V& v, P pred) {
+    using T = typename V::value_type;
+    auto n { v.size() };
+    if (n == 0) {
+        return 0;
+    }
+    auto first { std::to_address(v.begin()) };
+    if constexpr (Compaction::supports<T>) {
+        v.resize(Compaction::removeIf(first, first + n, pred) - first);
+    } else {
+        v.resize(std::remove_if(first, first + n, pred) - first);
+    }
+    return n - v.size();
+}
+
+// remove the elements equal to e
+template <ContiguousVector V>
+std::size_t remove(V& v, const typename V::value_type& e) {
+    using T = typename V::value_type;
+    auto n { v.size() };
+    if (n == 0) {
+        return 0;
+    }
+    auto first { std::to_address(v.begin()) };
+    if constexpr (Compaction::supports<T>) {
+        v.resize(Compaction::remove(first, first + n, T { e }) - first);
+    } else {
+        // e may be an element of v
+        v.resize(std::remove(first, first + n, T { e }) - first);
+    }
+    return n - v.size();
+}
+
+// remove the elements equal to the element before them, a sorted vector keeps one of each value
+template <ContiguousVector V>
+std::size_t unique(V& v) {
+    using T = typename V::value_type;
+    auto n { v.size() };
+    if (n == 0) {
+        return 0;
+    }
+    auto first { std::to_address(v.begin()) };
+    if constexpr (Compaction::supports<T>) {
+        v.resize(Compaction::unique(first, first + n) - first);
+    } else {
+        v.resize(std::unique(first, first + n) - first);
+    }
+    return n - v.size();
+}
+
+// the values SeenSet hashes by their bytes: arithmetic, and at most 8 bytes (a long double is larger, with padding)
+template <typename T>
+concept Hashable = Compaction::supports<T> && sizeof(T) <= 8;
+
+// a set of arithmetic values with open addressing (linear probing), for unique_global
+// 1- and 2-byte values index a table of all the possible values directly
+template <Hashable T>
+class SeenSet {
+    static constexpr bool DIRECT { sizeof(T) <= 2 };
+    using Bits = std::conditional_t<sizeof(T) <= 2, std::uint16_t, std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>;
+
+    std::vector<T> m_slots {};
+    std::vector<std::uint8_t> m_used {};
+    std::size_t m_mask { 0 };
+    int m_shift { 0 };
+
+    static Bits bits(T x) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // -0.0 == 0.0, so they must land in the same slot
+            if (x == 0) {
+                x = 0;
+            }
+        }
+        if constexpr (sizeof(T) == 1) {
+            return std::bit_cast<std::uint8_t>(x);
+        } else {
+            return std::bit_cast<Bits>(x);
+        }
+    }
+
+public:
+    // room for n values
+    explicit SeenSet(std::size_t n) {
+        auto size { DIRECT ? 1uz << (8 * sizeof(T)) : std::bit_ceil(std::max(2 * n, 16uz)) };
+        m_used.resize(size);
+        if constexpr (!DIRECT) {
+            m_slots.resize(size);
+        }
+        m_mask = size - 1;
+        m_shift = std::numeric_limits<std::size_t>::digits - std::countr_zero(size);
+    }
+
+    // add x, and return whether it was new (a NaN is always new, since it is not equal to itself)
+    bool insert(T x) {
+        if constexpr (DIRECT) {
+            if (m_used[bits(x)]) {
+                return false;
+            }
+            m_used[bits(x)] = 1;
+            return true;
+        } else {
+            // Fibonacci hashing, the top bits of the product are the slot
+            auto h { static_cast<std::size_t>(bits(x)) * 0x9E3779B97F4A7C15uz >> m_shift };
+            while (m_used[h]) {
+                if (m_slots[h] == x) {
+                    return false;
+                }
+                h = (h + 1) & m_mask;
+            }
+            m_used[h] = 1;
+            m_slots[h] = x;
+            return true;
+        }
+    }
+};
+
+// remove the elements equal to an element before them (anywhere), the vector needs not be sorted
+// a set of the values seen so far makes it O(n) expected time, instead of finding each element in the rest of the vector
+template <ContiguousVector V>
+    requires Compaction::supports<typename V::value_type> || requires (const typename V::value_type& e) { std::hash<typename V::value_type> {}(e); }
+std::size_t unique_global(V& v) {
+    using T = typename V::value_type;
+    auto n { v.size() };
+    if (n == 0) {
+        return 0;
+    }
+    auto first { std::to_address(v.begin()) };
+    if constexpr (Hashable<T>) {
+        SeenSet<T> seen { n };
+        v.resize(Compaction::removeIf(first, first + n, [&seen](const T& x) { return !seen.insert(x); }) - first);
+    } else {
+        std::unordered_set<T> seen {};
+        seen.reserve(n);
+        v.resize(std::remove_if(first, first + n, [&seen](const T& x) { return !seen.insert(x).second; }) - first);
+    }
+    return n - v.size();
+}
+
+}
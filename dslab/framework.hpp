@@ -1,5 +1,12 @@
 #pragma once
 
+// an empty member takes no space with [[no_unique_address]], which MSVC ignores in favour of its own spelling
+#ifdef _MSC_VER
+#define DSLAB_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define DSLAB_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 #include "framework/Object.hpp"
 #include "framework/DataStructure.hpp"
 #include "framework/Algorithm.hpp"
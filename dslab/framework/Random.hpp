@@ -1,23 +1,124 @@
 #pragma once
 
+#include "RandomEngine.hpp"
+#include <atomic>
+#include <bit>
+#include <concepts>
 #include <random>
+#include <span>
+#include <tuple>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DSLAB_RANDOM_SIMD
+#include <immintrin.h>
+#endif
 
 namespace dslab::framework {
 
-class Random {
-protected:
-    static std::mt19937 m_generator;
-    static std::uniform_int_distribution<std::size_t> m_distribution;
+// random numbers for the labs, every thread draws from an engine of its own (so it is safe to use from several threads)
+// the engine of a thread is a stream of the current seed:
+// - a thread that called bind(k) draws from stream k, so e.g. a task that binds its own index gets the same numbers
+//   whichever thread runs it and whenever it runs
+// - the other threads get the streams from UNBOUND on, in the order they first draw: only the first of them
+//   is reproducible (so a single-threaded program repeats itself after seed(value)), the others depend on the scheduling
+// E is the engine (see RandomEngine.hpp), Random uses xoshiro256**
+template <typename E>
+class BasicRandom {
+    static inline std::atomic<std::uint64_t> s_seed { std::random_device {}() };
+
+    // seed() starts a new epoch, the engine of a thread is derived again when it sees one
+    static inline std::atomic<std::size_t> s_epoch { 0 };
+    // the first stream of the threads that did not call bind, far from the ones the tasks bind
+    static constexpr std::uint64_t UNBOUND { 1uz << 63 };
+    static inline std::atomic<std::uint64_t> s_streams { UNBOUND };
+
+    struct Local {
+        E m_engine;
+        std::size_t m_epoch;
+        // the stream given by bind, if any
+        std::uint64_t m_stream;
+        bool m_bound;
+    };
+
+    static Local& local() {
+        static thread_local Local l { E { s_seed.load(), s_streams++ }, s_epoch.load(), 0, false };
+        if (auto epoch { s_epoch.load(std::memory_order_acquire) }; l.m_epoch != epoch) {
+            l.m_engine = E { s_seed.load(), l.m_bound ? l.m_stream : s_streams++ };
+            l.m_epoch = epoch;
+        }
+        return l;
+    }
+
+    // a uniform number in [0, range) from g, where range = 0 stands for 2^64
+    template <typename G>
+    static std::uint64_t offset(G& g, std::uint64_t range) {
+        return range == 0 ? g() : bounded(g, range);
+    }
 
 public:
+    using engine_type = E;
+
+    static E& engine() {
+        return local().m_engine;
+    }
+
+    // the engine of stream k of the current seed, for tasks that need their own reproducible numbers
+    static E stream(std::uint64_t k) {
+        return E { s_seed.load(), k };
+    }
+
+    // draw from stream k of the current seed on this thread, from its start, and again after every new seed
+    static void bind(std::uint64_t k) {
+        auto& l { local() };
+        l.m_engine = stream(k);
+        l.m_stream = k;
+        l.m_bound = true;
+    }
+
+    // the high and the low half of the 128-bit product a * b
+    // with the 128-bit integers of GCC and Clang, the intrinsics of MSVC, or four 32-bit products elsewhere
+    static std::pair<std::uint64_t, std::uint64_t> multiply(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        auto m { static_cast<unsigned __int128>(a) * b };
+        return { static_cast<std::uint64_t>(m >> 64), static_cast<std::uint64_t>(m) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+        std::uint64_t high;
+        auto low { _umul128(a, b, &high) };
+        return { high, low };
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+        return { __umulh(a, b), a * b };
+#else
+        constexpr std::uint64_t MASK { 0xFFFF'FFFF };
+        auto a0 { a & MASK }, a1 { a >> 32 }, b0 { b & MASK }, b1 { b >> 32 };
+        auto p00 { a0 * b0 }, p01 { a0 * b1 }, p10 { a1 * b0 }, p11 { a1 * b1 };
+        // the sum of three 32-bit numbers, it cannot overflow
+        auto middle { (p00 >> 32) + (p01 & MASK) + (p10 & MASK) };
+        return { p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32), middle << 32 | (p00 & MASK) };
+#endif
+    }
 
-    static auto& engine() {
-        return m_generator;
+    // a uniform number in [0, bound) from g, bound > 0 (Lemire)
+    // the high half of the 128-bit product of a random number and bound is the result,
+    // and the low half tells the few products that would make it biased, which are drawn again (a division only then)
+    template <typename G>
+    static std::uint64_t bounded(G& g, std::uint64_t bound) {
+        auto [high, low] { multiply(g(), bound) };
+        if (low < bound) {
+            auto threshold { -bound % bound };
+            while (low < threshold) {
+                std::tie(high, low) = multiply(g(), bound);
+            }
+        }
+        return high;
     }
 
     // returns a random number in the range [min, max]
     static std::size_t get(std::size_t min, std::size_t max) {
-        return m_distribution(m_generator, std::uniform_int_distribution<std::size_t>::param_type(min, max));
+        return min + offset(engine(), max - min + 1);
     }
     static std::size_t get(std::size_t max) {
         return get(0, max);
@@ -25,15 +126,97 @@ public:
     static std::size_t get() {
         return get(0, std::numeric_limits<std::size_t>::max());
     }
+
+    // the seed is shared by all threads, each one restarts from its new stream the next time it draws
     static void seed(std::size_t value) {
-        m_generator.seed(value);
+        s_seed.store(value);
+        s_streams.store(UNBOUND);
+        s_epoch.fetch_add(1, std::memory_order_release);
     }
     static void seed() {
-        m_generator.seed(std::random_device{}());
+        seed(static_cast<std::size_t>(std::random_device {}()) << 32 | std::random_device {}());
+    }
+
+    // fill out with random numbers in the range [lo, hi]
+    // when hi - lo < 2^32 and the CPU has AVX2, 8 numbers are drawn at once from 4 xoshiro256** lanes
+    // seeded by this thread's engine, so the numbers differ from the scalar loop but still depend on the seed only
+    template <std::integral T>
+    static void fill(std::span<T> out, T lo, T hi) {
+        auto range { static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo) + 1 };
+        auto& g { engine() };
+#ifdef DSLAB_RANDOM_SIMD
+        if (range != 0 && range <= 1uz << 32 && avx2()) {
+            fillAVX2(out.data(), out.size(), lo, range, g);
+            return;
+        }
+#endif
+        for (auto& x : out) {
+            x = static_cast<T>(static_cast<std::uint64_t>(lo) + offset(g, range));
+        }
+    }
+
+private:
+#ifdef DSLAB_RANDOM_SIMD
+    static bool avx2() {
+        static const bool supported { __builtin_cpu_supports("avx2") != 0 };
+        return supported;
+    }
+
+    template <typename T>
+    [[gnu::target("avx2")]] static void fillAVX2(T* out, std::size_t n, T lo, std::uint64_t range, E& g) {
+        std::uint64_t seeds[16];
+        for (auto& s : seeds) {
+            s = g();
+        }
+        auto s0 { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seeds)) };
+        auto s1 { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seeds + 4)) };
+        auto s2 { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seeds + 8)) };
+        auto s3 { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seeds + 12)) };
+
+        // each 64-bit lane is two 32-bit numbers, a 32-bit number x becomes the high half of x * range
+        auto full { range == 1uz << 32 };
+        auto bound { _mm256_set1_epi64x(static_cast<long long>(range)) };
+        auto threshold { full ? 0u : static_cast<std::uint32_t>(-static_cast<std::uint32_t>(range)) % static_cast<std::uint32_t>(range) };
+        // a signed comparison of x ^ 2^31 is an unsigned comparison of x
+        auto sign { _mm256_set1_epi32(static_cast<int>(0x80000000)) };
+        auto limit { _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(threshold)), sign) };
+
+        alignas(32) std::uint32_t block[8];
+        for (auto i { 0uz }; i < n; i += 8) {
+            // xoshiro256** on 4 lanes, the multiplications by 5 and 9 are shifts and additions
+            auto x5 { _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1) };
+            auto r { _mm256_or_si256(_mm256_slli_epi64(x5, 7), _mm256_srli_epi64(x5, 57)) };
+            auto v { _mm256_add_epi64(_mm256_slli_epi64(r, 3), r) };
+            auto t { _mm256_slli_epi64(s1, 17) };
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+
+            if (full) {
+                _mm256_store_si256(reinterpret_cast<__m256i*>(block), v);
+            } else {
+                auto even { _mm256_mul_epu32(v, bound) }, odd { _mm256_mul_epu32(_mm256_srli_epi64(v, 32), bound) };
+                _mm256_store_si256(reinterpret_cast<__m256i*>(block), _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010));
+                if (threshold != 0) {
+                    auto low { _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010) };
+                    auto biased { static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(
+                        _mm256_cmpgt_epi32(limit, _mm256_xor_si256(low, sign))))) };
+                    for (; biased != 0; biased &= biased - 1) {
+                        block[std::countr_zero(biased)] = static_cast<std::uint32_t>(bounded(g, range));
+                    }
+                }
+            }
+            for (auto j { 0uz }; j < 8 && i + j < n; ++j) {
+                out[i + j] = static_cast<T>(static_cast<std::uint64_t>(lo) + block[j]);
+            }
+        }
     }
+#endif
 };
 
-std::mt19937 Random::m_generator { std::random_device{}() };
-std::uniform_int_distribution<std::size_t> Random::m_distribution;
+using Random = BasicRandom<Xoshiro256>;
 
-}
\ No newline at end of file
+}
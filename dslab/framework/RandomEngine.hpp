@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace dslab::framework {
+
+// random engines for Random, each one is a uniform random bit generator of 64-bit numbers
+// an engine is constructed from a seed and a stream number, different streams of the same seed are independent,
+// so that every thread (or every task) can draw from its own stream and the results depend on the seed only
+
+// the generator used to expand a seed into the state of the others
+class SplitMix64 {
+    std::uint64_t m_state;
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit SplitMix64(std::uint64_t seed) : m_state { seed } {}
+
+    static constexpr result_type min() {
+        return 0;
+    }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        auto z { m_state += 0x9E3779B97F4A7C15 };
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+};
+
+// xoshiro256** (Blackman and Vigna): 256 bits of state, a few shifts, rotations and two cheap multiplications per number
+// the state of a stream is expanded by SplitMix64 from the seed mixed with the hash of the stream number
+class Xoshiro256 {
+    std::array<std::uint64_t, 4> m_state;
+
+    static constexpr std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit Xoshiro256(std::uint64_t seed, std::uint64_t stream = 0) {
+        SplitMix64 expand { seed ^ SplitMix64 { stream }() };
+        for (auto& s : m_state) {
+            s = expand();
+        }
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        auto& s { m_state };
+        auto result { rotl(s[1] * 5, 7) * 9 };
+        auto t { s[1] << 17 };
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+};
+
+// Philox4x32-10 (Salmon et al.): a counter-based engine, the n-th block of numbers is a keyed bijection of n
+// the key is the seed and the high half of the counter is the stream, so streams never overlap
+// each block gives 4 32-bit words, that is two numbers
+class Philox4x32 {
+    static constexpr std::uint32_t M0 { 0xD2511F53 }, M1 { 0xCD9E8D57 };
+    static constexpr std::uint32_t W0 { 0x9E3779B9 }, W1 { 0xBB67AE85 };
+    static constexpr int ROUNDS { 10 };
+
+    std::array<std::uint32_t, 2> m_key;
+    std::array<std::uint32_t, 4> m_counter;
+    std::array<std::uint32_t, 4> m_block {};
+    int m_used { 4 };
+
+    void generate() {
+        auto c { m_counter };
+        auto k { m_key };
+        for (auto round { 0 }; round < ROUNDS; ++round) {
+            auto p0 { static_cast<std::uint64_t>(M0) * c[0] }, p1 { static_cast<std::uint64_t>(M1) * c[2] };
+            c = {
+                static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0], static_cast<std::uint32_t>(p1),
+                static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1], static_cast<std::uint32_t>(p0)
+            };
+            k[0] += W0;
+            k[1] += W1;
+        }
+        m_block = c;
+        // the low half of the counter is the block number
+        if (++m_counter[0] == 0) {
+            ++m_counter[1];
+        }
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit Philox4x32(std::uint64_t seed, std::uint64_t stream = 0)
+        : m_key { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) },
+          m_counter { 0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) } {}
+
+    static constexpr result_type min() {
+        return 0;
+    }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        if (m_used == 4) {
+            generate();
+            m_used = 0;
+        }
+        auto result { static_cast<std::uint64_t>(m_block[m_used + 1]) << 32 | m_block[m_used] };
+        m_used += 2;
+        return result;
+    }
+};
+
+}
@@ -8,13 +8,17 @@ namespace dslab::framework {
 class TestItem {
 public:
     std::size_t m_value { 0 };
+    static std::size_t s_defaultCount;
     static std::size_t s_copyCount;
     static std::size_t s_moveCount;
     static void reset() {
+        s_defaultCount = 0;
         s_copyCount = 0;
         s_moveCount = 0;
     }
-    TestItem() = default;
+    TestItem() {
+        ++s_defaultCount;
+    }
     TestItem(std::size_t value) : m_value(value) {}
     TestItem(const TestItem& other) : m_value(other.m_value) {
         ++s_copyCount;
@@ -38,6 +42,7 @@ public:
     auto operator<=>(const TestItem& other) const = default;
 };
 
+std::size_t TestItem::s_defaultCount { 0 };
 std::size_t TestItem::s_copyCount { 0 };
 std::size_t TestItem::s_moveCount { 0 };
 
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "heap/Heap.hpp"
+#include "heap/AbstractPriorityQueue.hpp"
+#include "heap/PriorityQueue.hpp"
+
+namespace dslab {
+    using namespace heap;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../framework.hpp"
+
+namespace dslab::heap {
+
+    template <typename T>
+    class AbstractPriorityQueue : public DataStructure<T> {
+    public:
+        using value_type = T;
+
+        virtual void push(const T& e) = 0;
+        virtual void push(T&& e) = 0;
+        virtual T pop() = 0;
+        virtual const T& top() const = 0;
+        virtual void clear() = 0;
+    };
+
+}
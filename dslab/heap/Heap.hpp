@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../framework.hpp"
+
+namespace dslab::heap {
+
+// the algorithms of a D-ary heap on contiguous elements: a[0] is the top, and the children of a[i] are
+// a[D * i + 1], ..., a[D * i + D], none of them before its parent in the order of cmp (the greatest is on top)
+// a wider heap is shallower, so a push compares fewer elements, and the D children of a node are adjacent,
+// so finding the greatest of them reads one or two cache lines (D = 4 or 8) where a binary heap reads one per level
+template <std::size_t D>
+requires (D >= 2)
+class Heap {
+public:
+    static constexpr std::size_t parent(std::size_t i) {
+        return (i - 1) / D;
+    }
+
+    static constexpr std::size_t child(std::size_t i) {
+        return D * i + 1;
+    }
+
+    // move a[i] up to its place, the elements before it are a heap
+    template <typename T, typename Cmp>
+    static void siftUp(T* a, std::size_t i, const Cmp& cmp) {
+        T x { std::move(a[i]) };
+        while (i > 0) {
+            auto p { parent(i) };
+            if (!cmp(a[p], x)) break;
+            a[i] = std::move(a[p]);
+            i = p;
+        }
+        a[i] = std::move(x);
+    }
+
+    // move a[i] down to its place in a (n elements), its subtrees are heaps
+    template <typename T, typename Cmp>
+    static void siftDown(T* a, std::size_t n, std::size_t i, const Cmp& cmp) {
+        T x { std::move(a[i]) };
+        for (auto c { child(i) }; c < n; c = child(i)) {
+            auto m { maxChild(a, c, n, cmp) };
+            if (!cmp(x, a[m])) break;
+            a[i] = std::move(a[m]);
+            i = m;
+        }
+        a[i] = std::move(x);
+    }
+
+    // Floyd's construction: every inner node is sifted down, from the last one to the top, in O(n)
+    template <typename T, typename Cmp>
+    static void heapify(T* a, std::size_t n, const Cmp& cmp) {
+        if (n < 2) return;
+        for (auto i { parent(n - 1) + 1 }; i-- > 0;) {
+            siftDown(a, n, i, cmp);
+        }
+    }
+
+    // move the top of the heap a (n elements) to a[n - 1], the first n - 1 elements remain a heap
+    // the hole left by the top goes down to a leaf along the greatest children, without comparing them with the last
+    // element, which is put there and sifted up: it came from the bottom, so it seldom goes up far (bottom-up heapsort)
+    template <typename T, typename Cmp>
+    static void pop(T* a, std::size_t n, const Cmp& cmp) {
+        if (n < 2) return;
+        T x { std::move(a[n - 1]) };
+        a[n - 1] = std::move(a[0]);
+        auto i { 0uz };
+        for (auto c { child(0) }; c < n - 1; c = child(i)) {
+            auto m { maxChild(a, c, n - 1, cmp) };
+            a[i] = std::move(a[m]);
+            i = m;
+        }
+        a[i] = std::move(x);
+        siftUp(a, i, cmp);
+    }
+
+    // heapsort: the elements end in the order of cmp
+    template <typename T, typename Cmp>
+    static void sort(T* a, std::size_t n, const Cmp& cmp) {
+        heapify(a, n, cmp);
+        for (auto m { n }; m > 1; --m) {
+            pop(a, m, cmp);
+        }
+    }
+
+private:
+    // the greatest of the children a[c], ..., a[c + D - 1] that are before a[n]
+    template <typename T, typename Cmp>
+    static std::size_t maxChild(const T* a, std::size_t c, std::size_t n, const Cmp& cmp) {
+        auto m { c };
+        for (auto j { c + 1 }, end { std::min(c + D, n) }; j < end; ++j) {
+            if (cmp(a[m], a[j])) {
+                m = j;
+            }
+        }
+        return m;
+    }
+};
+
+}
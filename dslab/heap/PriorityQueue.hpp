@@ -0,0 +1,121 @@
+#pragma once
+
+#include "AbstractPriorityQueue.hpp"
+#include "Heap.hpp"
+#include "../vector.hpp"
+#include <ranges>
+
+namespace dslab::heap {
+
+// a priority queue on a D-ary heap (see Heap) in a vector, top() is the greatest element in the order of Cmp
+// push and pop take O(log n) moves, building from n elements takes O(n) (Floyd's construction)
+template <typename T, typename Cmp = std::less<T>, std::size_t D = 2>
+class PriorityQueue : public AbstractPriorityQueue<T> {
+protected:
+    DefaultVector<T> V;
+    DSLAB_NO_UNIQUE_ADDRESS Cmp m_cmp {};
+
+    T* data() {
+        return std::to_address(V.begin());
+    }
+
+public:
+    PriorityQueue() = default;
+    PriorityQueue(const PriorityQueue& other) = default;
+    PriorityQueue(PriorityQueue&& other) noexcept = default;
+    PriorityQueue& operator=(const PriorityQueue& other) = default;
+    // not noexcept, moving from a vector on another resource allocates, see Vector::operator=(Vector&&)
+    PriorityQueue& operator=(PriorityQueue&& other) = default;
+
+    explicit PriorityQueue(const Cmp& cmp) : m_cmp { cmp } {}
+
+    PriorityQueue(std::initializer_list<T> ilist, const Cmp& cmp = Cmp {}) : V(ilist), m_cmp { cmp } {
+        Heap<D>::heapify(data(), V.size(), m_cmp);
+    }
+    PriorityQueue& operator=(std::initializer_list<T> ilist) {
+        V = ilist;
+        Heap<D>::heapify(data(), V.size(), m_cmp);
+        return *this;
+    }
+
+    template <std::ranges::input_range R>
+    explicit PriorityQueue(R&& r, const Cmp& cmp = Cmp {}) : m_cmp { cmp } {
+        push_range(std::forward<R>(r));
+    }
+
+    void push(const T& e) override {
+        V.push_back(e);
+        Heap<D>::siftUp(data(), V.size() - 1, m_cmp);
+    }
+
+    void push(T&& e) override {
+        V.push_back(std::move(e));
+        Heap<D>::siftUp(data(), V.size() - 1, m_cmp);
+    }
+
+    // the elements are appended, then the heap is rebuilt if they are at least as many as those already there,
+    // otherwise each one is sifted up (a random element rarely goes up more than a level or two)
+    template <std::ranges::input_range R>
+    void push_range(R&& r) {
+        auto old { V.size() };
+        if constexpr (std::ranges::sized_range<R>) {
+            V.reserve(old + std::ranges::size(r));
+        }
+        for (auto&& e : r) {
+            V.push_back(std::forward<decltype(e)>(e));
+        }
+        if (V.size() - old >= old) {
+            Heap<D>::heapify(data(), V.size(), m_cmp);
+        } else {
+            for (auto i { old }; i < V.size(); ++i) {
+                Heap<D>::siftUp(data(), i, m_cmp);
+            }
+        }
+    }
+
+    T pop() override {
+        Heap<D>::pop(data(), V.size(), m_cmp);
+        return V.pop_back();
+    }
+
+    // remove the k greatest elements (or all of them if there are fewer), and return them from the greatest
+    // each pop moves the top behind the heap, so they are taken out of the vector together
+    DefaultVector<T> pop_n(std::size_t k) {
+        auto n { V.size() };
+        k = std::min(k, n);
+        for (auto m { n }; m > n - k; --m) {
+            Heap<D>::pop(data(), m, m_cmp);
+        }
+        DefaultVector<T> R {};
+        R.reserve(k);
+        for (auto i { n }; i > n - k; --i) {
+            R.push_back(std::move(V[i - 1]));
+        }
+        V.resize(n - k);
+        return R;
+    }
+
+    const T& top() const override {
+        return V.front();
+    }
+
+    std::size_t size() const override {
+        return V.size();
+    }
+
+    void reserve(std::size_t n) {
+        V.reserve(n);
+    }
+
+    virtual ~PriorityQueue() = default;
+
+    void clear() override {
+        V.clear();
+    }
+
+    std::string type_name() const override {
+        return std::format("PriorityQueue<{}-ary, {}>", D, V.type_name());
+    }
+};
+
+}
@@ -26,6 +26,7 @@ public:
     virtual iterator insertAsPrev(iterator p, T&& e) = 0;
 
     // insert e means insert e as the previous element of p
+    using dslab::vector::LinearList<T, iterator, const_iterator>::insert;
     iterator insert(iterator p, const T& e) override {
         return insertAsPrev(p, e);
     }
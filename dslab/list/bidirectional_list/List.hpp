@@ -111,6 +111,27 @@ public:
         return insertAsNext(--p, std::move(e));
     }
 
+    // the new nodes are chained first, and then linked before p at once
+    iterator insert(iterator p, std::size_t n, const T& e) override {
+        if (n == 0) {
+            return p;
+        }
+        auto first { std::make_unique<ListNode<T>>(e) };
+        auto last { first.get() };
+        for (auto i { 1uz }; i < n; ++i) {
+            last->next() = std::make_unique<ListNode<T>>(e);
+            last->next()->prev() = last;
+            last = last->next().get();
+        }
+        auto prev { p.node()->prev() };
+        first->prev() = prev;
+        last->next() = std::move(prev->next());
+        p.node()->prev() = last;
+        prev->next() = std::move(first);
+        m_size += n;
+        return iterator { this, prev->next().get() };
+    }
+
     iterator find(const T& e) const override {
         auto p { begin() };
         while (p != end() && *p != e) {
@@ -127,6 +148,20 @@ public:
         return q;
     }
 
+    // [first, last) is cut out as one chain, which is released when it goes out of scope
+    iterator erase(iterator first, iterator last) override {
+        if (first == last) {
+            return last;
+        }
+        auto n { static_cast<std::size_t>(std::distance(first, last)) };
+        auto prev { first.node()->prev() }, back { last.node()->prev() };
+        auto chain { std::move(prev->next()) };
+        prev->next() = std::move(back->next());
+        last.node()->prev() = prev;
+        m_size -= n;
+        return last;
+    }
+
     std::string type_name() const override {
         return "List (Bidirectional)";
     }
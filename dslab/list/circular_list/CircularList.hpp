@@ -18,6 +18,7 @@ public:
     using iterator = AbstractList<T>::iterator;
     using AbstractCircularList<T>::begin;
     using AbstractCircularList<T>::end;
+    using AbstractCircularList<T>::erase;
 
     std::size_t size() const override { return m_size; }
 
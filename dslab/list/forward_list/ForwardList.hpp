@@ -27,6 +27,7 @@ public:
     using iterator = AbstractForwardList<T>::iterator;
     using AbstractForwardList<T>::begin;
     using AbstractForwardList<T>::end;
+    using AbstractForwardList<T>::insert;
 
     std::size_t size() const override { return m_size; }
 
@@ -123,6 +124,29 @@ public:
         return p;
     }
 
+    // like insertAsPrev, the new nodes go after p and the element of p moves to the last of them
+    iterator insert(iterator p, std::size_t n, const T& e) override {
+        if (n == 0) {
+            return p;
+        }
+        T value { e }; // e may be the element of p
+        auto chain { std::make_unique<ForwardListNode<T>>(std::move(*p)) };
+        auto last { chain.get() };
+        for (auto i { 1uz }; i < n; ++i) {
+            auto node { std::make_unique<ForwardListNode<T>>(value) };
+            node->next() = std::move(chain);
+            chain = std::move(node);
+        }
+        *p = std::move(value);
+        last->next() = std::move(p.node()->next());
+        if (p == end()) {
+            m_tail = last;
+        }
+        p.node()->next() = std::move(chain);
+        m_size += n;
+        return p;
+    }
+
     iterator find(const T& e) const override {
         auto p { begin() };
         while (p != end() && *p != e) {
@@ -137,6 +161,22 @@ public:
         return eraseAfter(p);
     }
 
+    // like erase, the element of last moves to first, and (first, last] is cut out as one chain
+    iterator erase(iterator first, iterator last) override {
+        if (first == last) {
+            return first;
+        }
+        auto n { static_cast<std::size_t>(std::distance(first, last)) };
+        *first = std::move(*last);
+        auto chain { std::move(first.node()->next()) };
+        first.node()->next() = std::move(last.node()->next());
+        if (last == end()) {
+            m_tail = first.node();
+        }
+        m_size -= n;
+        return first;
+    }
+
     iterator eraseAfter(iterator p) override {
         auto q { p + 1 };
         p.node()->next() = std::move(q.node()->next());
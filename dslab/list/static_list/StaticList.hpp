@@ -50,6 +50,7 @@ class StaticList : public AbstractStaticList<T> {
 public:
     using AbstractStaticList<T>::begin;
     using AbstractStaticList<T>::end;
+    using AbstractStaticList<T>::erase;
 
     std::size_t size() const override {
         return m_size;
@@ -2,6 +2,12 @@
 
 #include "sort/AbstractSort.hpp"
 #include "sort/MergeSort.hpp"
+#include "sort/ParallelMergeSort.hpp"
+#include "sort/TimSort.hpp"
+#include "sort/QuickSort.hpp"
+#include "sort/RadixSort.hpp"
+#include "sort/HeapSort.hpp"
+#include "sort/ExternalSort.hpp"
 #include "sort/ListMergeSort.hpp"
 
 namespace dslab {
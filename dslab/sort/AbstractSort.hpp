@@ -8,16 +8,33 @@ template <typename T, template<typename> typename L = DefaultVector>
 requires std::is_base_of_v<LinearList<T, typename L<T>::iterator, typename L<T>::const_iterator>, L<T>>
 class AbstractSort : public Algorithm<void(L<T>&)> {
 protected:
-    std::function<bool(const T&, const T&)> cmp { std::less<T>() };
-    virtual void sort(L<T>& V) = 0;
+    using Comparator = std::function<bool(const T&, const T&)>;
+
+    // std::less by default, none if T has no operator< (a sort by key, like RadixSort, does not need one)
+    Comparator m_cmp { defaultCmp() };
+
+    // sort V by cmp, which is the comparator given to operator(), or m_cmp
+    // a sorter passes cmp down to its helpers instead of storing it
+    virtual void sort(L<T>& V, const Comparator& cmp) = 0;
+
+    static Comparator defaultCmp() {
+        if constexpr (requires (const T& a, const T& b) { a < b; }) {
+            return std::less<T>();
+        } else {
+            return {};
+        }
+    }
 public:
-    template <typename Comparator>
-    void operator()(L<T>& V, Comparator&& cmp) {
-        this->cmp = cmp;
-        sort(V);
+    // whether the order is the one of the comparator, a sort by key (like RadixSort) ignores it
+    static constexpr bool USES_COMPARATOR { true };
+
+    // the calls only read the sorter, so one sorter can be used from several threads at once, with any comparators
+    template <typename C>
+    void operator()(L<T>& V, C&& cmp) {
+        sort(V, Comparator { std::forward<C>(cmp) });
     }
     void operator()(L<T>& V) override {
-        sort(V);
+        sort(V, m_cmp);
     }
 };
 
@@ -0,0 +1,402 @@
+#pragma once
+
+#include "QuickSort.hpp"
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace dslab::sort {
+
+// what an ExternalSort call did
+struct ExternalSortStats {
+    // the elements, and their bytes (the size of the file without its header)
+    std::size_t m_size;
+    std::size_t m_bytes;
+    // the sorted runs written by the first pass, and the runs merged at once by the others
+    std::size_t m_runs;
+    std::size_t m_fanIn;
+    // the passes over the data, each one reads and writes all of it once (the first one forms the runs)
+    std::size_t m_passes;
+};
+
+// sort a vector file (see VectorFile) larger than the memory into another one
+// - the input is read in chunks of memory / 2 bytes, each chunk is sorted by Sort and written to a temporary run file;
+//   the next chunk is read while the current one is sorted and written, so the two chunks take all the memory,
+//   and the buffer of Sort comes on top of it: nothing for QuickSort, a chunk for the LSD RadixSort,
+//   whose peak is then about 1.5 * memory bytes
+// - the runs are merged fanIn at a time through a loser tree, into new runs until one merge can produce the output;
+//   every run is read by blocks of BLOCK bytes, and so is the output written, each with two blocks:
+//   the next block of a run is read, and the last block of the output is written, while the merge goes on with the other
+// the fan-in is the number of runs whose blocks fit in the memory, (memory / BLOCK - 2) / 2, so a file up to
+// memory * fanIn / 2 bytes takes two passes, about 256 GiB for 1 GiB of memory
+// the merge is stable (ties go to the earlier run), so the sort is stable if Sort is
+// a Sort that ignores the comparator (RadixSort, by the key) only sorts by std::less, which is the order of its keys
+// the run files are named after the process and a random number, and removed even if the sort throws
+template <typename T, template <typename, template<typename> typename> typename Sort = QuickSort>
+requires VectorFile::supports<T> && std::is_base_of_v<AbstractSort<T, DefaultVector>, Sort<T, DefaultVector>>
+class ExternalSort {
+    using Cmp = std::function<bool(const T&, const T&)>;
+    using path = std::filesystem::path;
+
+    std::size_t m_memory;
+    std::filesystem::path m_tempDir;
+    Sort<T, DefaultVector> m_sorter {};
+
+    static T* data(DefaultVector<T>& V) {
+        return std::to_address(V.begin());
+    }
+
+    // open a vector file of T for reading at its first element, and return its number of elements
+    static std::size_t open(std::ifstream& in, const path& file) {
+        in.open(file, std::ios::binary | std::ios::ate);
+        if (!in) {
+            throw std::runtime_error(std::format("cannot open vector file {}", file.string()));
+        }
+        auto fileSize { static_cast<std::size_t>(in.tellg()) };
+        VectorFileHeader h {};
+        if (fileSize < VectorFile::HEADER_SIZE || !in.seekg(0).read(reinterpret_cast<char*>(&h), sizeof(h))) {
+            throw std::runtime_error("not a vector file");
+        }
+        VectorFile::check<T>(h, fileSize);
+        in.seekg(VectorFile::HEADER_SIZE);
+        return h.m_size;
+    }
+
+    static void read(std::ifstream& in, T* p, std::size_t n) {
+        if (n > 0 && !in.read(reinterpret_cast<char*>(p), static_cast<std::streamsize>(n * sizeof(T)))) {
+            throw std::runtime_error("cannot read vector file");
+        }
+    }
+
+    // the elements of a run, a block at a time, the next block is read in the background
+    class Reader {
+        std::ifstream m_in {};
+        std::size_t m_size;
+        // the elements not read yet, only touched by the reading in the background once it started
+        std::size_t m_left;
+        DefaultVector<T> m_blocks[2];
+        std::size_t m_current { 0 };
+        T* m_pos {};
+        T* m_end {};
+        std::future<std::size_t> m_next {};
+
+        void prefetch() {
+            m_next = std::async(std::launch::async, [this, block { data(m_blocks[1 - m_current]) }] {
+                auto k { std::min(m_left, m_blocks[0].size()) };
+                read(m_in, block, k);
+                m_left -= k;
+                return k;
+            });
+        }
+
+        void refill() {
+            auto k { m_next.get() };
+            m_current = 1 - m_current;
+            m_pos = data(m_blocks[m_current]);
+            m_end = m_pos + k;
+            if (k > 0) {
+                prefetch();
+            }
+        }
+
+    public:
+        Reader(const path& file, std::size_t block) : m_size { open(m_in, file) }, m_left { m_size } {
+            for (auto& b : m_blocks) {
+                b.resize(std::min(block, std::max(m_left, 1uz)));
+            }
+            m_current = 1;
+            prefetch();
+            refill();
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        ~Reader() {
+            if (m_next.valid()) {
+                m_next.wait();
+            }
+        }
+
+        // the number of elements of the run
+        std::size_t size() const {
+            return m_size;
+        }
+
+        bool empty() const {
+            return m_pos == m_end;
+        }
+
+        const T& front() const {
+            return *m_pos;
+        }
+
+        void pop() {
+            if (++m_pos == m_end) {
+                refill();
+            }
+        }
+    };
+
+    // a vector file of n elements written a block at a time, the full block is written in the background
+    class Writer {
+        std::ofstream m_out {};
+        DefaultVector<T> m_blocks[2];
+        std::size_t m_current { 0 };
+        T* m_pos {};
+        T* m_end {};
+        std::future<void> m_pending {};
+
+        void write(const T* p, std::size_t n) {
+            if (n > 0 && !m_out.write(reinterpret_cast<const char*>(p), static_cast<std::streamsize>(n * sizeof(T)))) {
+                throw std::runtime_error("cannot write vector file");
+            }
+        }
+
+        void flush() {
+            if (m_pending.valid()) {
+                m_pending.get();
+            }
+            auto block { data(m_blocks[m_current]) };
+            m_pending = std::async(std::launch::async, [this, block, n { static_cast<std::size_t>(m_pos - block) }] {
+                write(block, n);
+            });
+            m_current = 1 - m_current;
+            m_pos = data(m_blocks[m_current]);
+            m_end = m_pos + m_blocks[m_current].size();
+        }
+
+    public:
+        Writer(const path& file, std::size_t n, std::size_t block) : m_out { file, std::ios::binary | std::ios::trunc } {
+            auto h { VectorFile::header<T>(n, n) };
+            char head[VectorFile::HEADER_SIZE] {};
+            std::memcpy(head, &h, sizeof(h));
+            if (!m_out.write(head, VectorFile::HEADER_SIZE)) {
+                throw std::runtime_error(std::format("cannot write vector file {}", file.string()));
+            }
+            for (auto& b : m_blocks) {
+                b.resize(std::min(block, std::max(n, 1uz)));
+            }
+            m_pos = data(m_blocks[0]);
+            m_end = m_pos + m_blocks[0].size();
+        }
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        ~Writer() {
+            if (m_pending.valid()) {
+                m_pending.wait();
+            }
+        }
+
+        void push(const T& e) {
+            *m_pos++ = e;
+            if (m_pos == m_end) {
+                flush();
+            }
+        }
+
+        void close() {
+            flush();
+            m_pending.get();
+            if (!m_out.flush()) {
+                throw std::runtime_error("cannot write vector file");
+            }
+        }
+    };
+
+    // a tournament among k sources: every inner node keeps the loser of the match played there, and node 0 the winner,
+    // so when the winner is replaced, only the matches on its path are played again, log k comparisons
+    // before(a, b) tells whether source a goes before source b, the source k stands for one before all the others
+    template <typename Before>
+    class LoserTree {
+        std::vector<std::size_t> m_node;
+        std::size_t m_k;
+        Before m_before;
+
+    public:
+        LoserTree(std::size_t k, Before before) : m_node(std::max(k, 1uz), k), m_k { k }, m_before { before } {
+            for (auto i { k }; i-- > 0;) {
+                replay(i);
+            }
+        }
+
+        std::size_t winner() const {
+            return m_node[0];
+        }
+
+        // source s has a new front, play its matches again
+        void replay(std::size_t s) {
+            for (auto t { (s + m_k) / 2 }; t > 0; t /= 2) {
+                if (m_before(m_node[t], s)) {
+                    std::swap(s, m_node[t]);
+                }
+            }
+            m_node[0] = s;
+        }
+    };
+
+    // the names of the run files of one sort, which are removed (if they are still there) when it ends, or throws
+    class RunFiles {
+        path m_dir;
+        std::string m_prefix;
+        std::vector<path> m_files {};
+
+        static long processId() {
+#ifdef _WIN32
+            return _getpid();
+#else
+            return getpid();
+#endif
+        }
+
+    public:
+        explicit RunFiles(path dir)
+            : m_dir { std::move(dir) }, m_prefix { std::format("dslab-external-{}-{:016x}", processId(), Random::get()) } {}
+
+        RunFiles(const RunFiles&) = delete;
+        RunFiles& operator=(const RunFiles&) = delete;
+
+        ~RunFiles() {
+            for (const auto& file : m_files) {
+                std::error_code ec {};
+                std::filesystem::remove(file, ec);
+            }
+        }
+
+        // the name of a new run file
+        path next() {
+            return m_files.emplace_back(m_dir / std::format("{}-{}.vec", m_prefix, m_files.size()));
+        }
+    };
+
+    // merge the runs into a new vector file
+    void merge(const std::vector<path>& runs, const path& output, std::size_t block, const Cmp& cmp) {
+        std::vector<std::unique_ptr<Reader>> readers {};
+        auto n { 0uz };
+        for (const auto& run : runs) {
+            readers.push_back(std::make_unique<Reader>(run, block));
+            n += readers.back()->size();
+        }
+        Writer writer { output, n, block };
+        auto k { readers.size() };
+        auto before { [&](std::size_t a, std::size_t b) {
+            if (a == k || b == k) return a == k;
+            if (readers[a]->empty() || readers[b]->empty()) return readers[b]->empty() && !readers[a]->empty();
+            const auto &x { readers[a]->front() }, &y { readers[b]->front() };
+            return cmp(x, y) || (a < b && !cmp(y, x));
+        } };
+        LoserTree<decltype(before)> tree { k, before };
+        for (auto i { 0uz }; i < n; ++i) {
+            auto w { tree.winner() };
+            writer.push(readers[w]->front());
+            readers[w]->pop();
+            tree.replay(w);
+        }
+        writer.close();
+    }
+
+    // sort the chunks of the input into runs, the first one goes to output if it is the only one
+    std::vector<path> formRuns(const path& input, const path& output, RunFiles& files, const Cmp& cmp) {
+        std::ifstream in {};
+        auto left { open(in, input) };
+        auto chunk { std::max(m_memory / 2 / sizeof(T), 1uz) };
+        DefaultVector<T> chunks[2] {};
+        auto next { [&](DefaultVector<T>& V) {
+            V.resize(std::min(left, chunk));
+            read(in, data(V), V.size());
+            left -= V.size();
+        } };
+        next(chunks[0]);
+        std::vector<path> runs {};
+        for (auto c { 0uz }; ; c = 1 - c) {
+            // left belongs to the reading from here on
+            auto file { runs.empty() && left == 0 ? output : files.next() };
+            std::future<void> reading {};
+            if (left > 0) {
+                reading = std::async(std::launch::async, next, std::ref(chunks[1 - c]));
+            }
+            if constexpr (Sort<T, DefaultVector>::USES_COMPARATOR) {
+                m_sorter(chunks[c], cmp);
+            } else {
+                m_sorter(chunks[c]);
+            }
+            VectorFile::save(file.string(), chunks[c]);
+            runs.push_back(file);
+            if (!reading.valid()) break;
+            reading.get();
+        }
+        return runs;
+    }
+
+    // sort the vector file input into output by cmp, see operator()
+    ExternalSortStats sort(const std::string& input, const std::string& output, const Cmp& cmp) {
+        RunFiles files { m_tempDir };
+        auto block { std::max(BLOCK / sizeof(T), 1uz) };
+        auto runs { formRuns(input, output, files, cmp) };
+        ExternalSortStats stats {};
+        stats.m_runs = runs.size();
+        stats.m_fanIn = fanIn();
+        stats.m_passes = 1;
+        // the runs of a pass are merged fanIn at a time, the last pass into the output
+        for (; runs.size() > 1; ++stats.m_passes) {
+            std::vector<path> merged {};
+            for (auto first { 0uz }; first < runs.size(); first += fanIn()) {
+                std::vector<path> group(runs.begin() + first, runs.begin() + std::min(first + fanIn(), runs.size()));
+                auto file { runs.size() <= fanIn() ? path { output } : files.next() };
+                if (group.size() == 1) {
+                    std::filesystem::rename(group[0], file);
+                } else {
+                    merge(group, file, block, cmp);
+                    for (const auto& run : group) {
+                        std::filesystem::remove(run);
+                    }
+                }
+                merged.push_back(file);
+            }
+            runs = std::move(merged);
+        }
+        std::ifstream in {};
+        stats.m_size = open(in, output);
+        stats.m_bytes = stats.m_size * sizeof(T);
+        return stats;
+    }
+
+public:
+    // the size of the blocks of the merge, and the least memory that can be given
+    static constexpr std::size_t BLOCK { 1uz << 20 };
+    static constexpr std::size_t MIN_MEMORY { 6 * BLOCK };
+
+    explicit ExternalSort(std::size_t memory, std::filesystem::path tempDir = std::filesystem::temp_directory_path())
+        : m_memory { std::max(memory, MIN_MEMORY) }, m_tempDir { std::move(tempDir) } {}
+
+    std::size_t fanIn() const {
+        return (m_memory / BLOCK - 2) / 2;
+    }
+
+    // sort the vector file input into output (a new file, which must not be input), by std::less
+    ExternalSortStats operator()(const std::string& input, const std::string& output) {
+        return sort(input, output, std::less<T>());
+    }
+
+    // the same by cmp, if Sort sorts the runs by it too
+    ExternalSortStats operator()(const std::string& input, const std::string& output, const Cmp& cmp)
+    requires Sort<T, DefaultVector>::USES_COMPARATOR {
+        return sort(input, output, cmp);
+    }
+
+    std::string type_name() const {
+        return std::format("External Sort [{}, {} MiB]", m_sorter.type_name(), m_memory >> 20);
+    }
+};
+
+}
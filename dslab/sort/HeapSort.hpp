@@ -0,0 +1,26 @@
+#pragma once
+
+#include "AbstractSort.hpp"
+#include "../heap/Heap.hpp"
+
+namespace dslab::sort {
+
+// heapsort on a D-ary heap, for vectors (the elements are contiguous): unstable, in place, O(n log n) in the worst case
+// the heap is built by Floyd's construction, and every pop takes the hole down to a leaf first (see Heap::pop)
+template <typename T, template<typename> typename L, std::size_t D = 4>
+requires std::is_base_of_v<AbstractVector<T>, L<T>>
+class HeapSort : public AbstractSort<T, L> {
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+
+protected:
+    void sort(L<T>& V, const Comparator& cmp) override {
+        heap::Heap<D>::sort(std::to_address(V.begin()), V.size(), cmp);
+    }
+
+public:
+    std::string type_name() const override {
+        return std::format("Heap Sort ({}-ary)", D);
+    }
+};
+
+}
@@ -10,7 +10,7 @@ requires std::is_base_of_v<AbstractList<T>, L<T>>
 class ListMergeSort : public AbstractSort<T, L> {
     using node_ptr = std::unique_ptr<typename L<T>::node_type>;
     using iterator = typename L<T>::iterator;
-    using AbstractSort<T, L>::cmp;
+    using Comparator = typename AbstractSort<T, L>::Comparator;
     constexpr node_ptr&& ptr(iterator pos) {
         return std::move((--pos).node()->next());
     }
@@ -20,7 +20,7 @@ class ListMergeSort : public AbstractSort<T, L> {
         ++prev;
         next = std::move(prev.node()->next());
     }
-    iterator merge(iterator lo, iterator mi, iterator hi) {
+    iterator merge(iterator lo, iterator mi, iterator hi, const Comparator& cmp) {
         auto plo { ptr(lo) }, pmi { ptr(mi) }, tail { ptr(hi) };
         auto head { lo - 1 }, last { head };
         while (plo && pmi) {
@@ -40,16 +40,16 @@ class ListMergeSort : public AbstractSort<T, L> {
         last.node()->next() = std::move(tail);
         return ++head;
     }
-    iterator mergeSort(iterator lo, iterator hi, std::size_t sz) {
+    iterator mergeSort(iterator lo, iterator hi, std::size_t sz, const Comparator& cmp) {
         if (sz <= 1) return lo;
         auto mi { lo + sz / 2 };
-        lo = mergeSort(lo, mi, sz / 2);
-        mi = mergeSort(mi, hi, sz - sz / 2);
-        return merge(lo, mi, hi);
+        lo = mergeSort(lo, mi, sz / 2, cmp);
+        mi = mergeSort(mi, hi, sz - sz / 2, cmp);
+        return merge(lo, mi, hi, cmp);
     }
 protected:
-    void sort(L<T>& l) override {
-        mergeSort(l.begin(), l.end(), l.size());
+    void sort(L<T>& l, const Comparator& cmp) override {
+        mergeSort(l.begin(), l.end(), l.size(), cmp);
     }
 public:
     std::string type_name() const override {
@@ -4,35 +4,40 @@
 
 namespace dslab::sort {
 
+// the merge buffer and the comparator belong to a sort() call, not to the sorter,
+// so a sorter can be used from several threads at once (see AbstractSort)
 template <typename T, template<typename> typename L>
 class MergeSort : public AbstractSort<T, L> {
 protected:
     using iterator = typename L<T>::iterator;
-    using AbstractSort<T, L>::cmp;
+    using buffer = typename Vector<T>::iterator;
+    using Comparator = typename AbstractSort<T, L>::Comparator;
 
-    void merge(iterator lo, iterator mi, iterator hi, std::size_t ls) {
-        static Vector<T> W {};
-        W.resize(ls);
-        std::move(lo, mi, W.begin());
-        auto i { W.begin() }, j { mi }, k { lo };
-        while (i != W.end() && j != hi) {
+    // the left part is moved to W, which has room for it, and merged back with the right part
+    // the rest of the right part is already in place, so only the left part is moved at the end
+    void merge(iterator lo, iterator mi, iterator hi, buffer W, const Comparator& cmp) {
+        auto we { std::move(lo, mi, W) };
+        auto i { W }, j { mi }, k { lo };
+        while (i != we && j != hi) {
             if (cmp(*j, *i)) {
                 *k++ = std::move(*j++);
             } else {
                 *k++ = std::move(*i++);
             }
         }
-        std::move(i, W.end(), k);
+        std::move(i, we, k);
     }
-    void mergeSort(iterator lo, iterator hi, std::size_t size) {
+    void mergeSort(iterator lo, iterator hi, std::size_t size, buffer W, const Comparator& cmp) {
         if (size < 2) return;
         auto mi { lo + size / 2 };
-        mergeSort(lo, mi, size / 2);
-        mergeSort(mi, hi, size - size / 2);
-        merge(lo, mi, hi, size / 2);
+        mergeSort(lo, mi, size / 2, W, cmp);
+        mergeSort(mi, hi, size - size / 2, W, cmp);
+        merge(lo, mi, hi, W, cmp);
     }
-    void sort(L<T>& V) override {
-        mergeSort(V.begin(), V.end(), V.size());
+    void sort(L<T>& V, const Comparator& cmp) override {
+        // a left part is never longer than half of the vector, so one buffer of n / 2 serves every merge
+        Vector<T> W(V.size() / 2);
+        mergeSort(V.begin(), V.end(), V.size(), W.begin(), cmp);
     }
 
 public:
@@ -42,28 +47,49 @@ public:
 
 };
 
+// every pass merges the runs of width w from one of V and W into the other (ping-pong), W holds all n elements,
+// so an element is moved once per pass, and the result is moved back to V only if the number of passes is odd
 template <typename T, template<typename> typename L>
 class MergeSortUpward : public MergeSort<T, L> {
 protected:
-    using MergeSort<T, L>::merge;
-    void sort(L<T>& V) override {
-        auto n { V.size() };
-        for (auto w { 1uz }; w < n; w *= 2) {
-            auto lo { V.begin() };
-            auto i { 2 * w };
-            while (i < n) {
-                auto mi { lo + w };
-                auto hi { mi + w };
-                merge(lo, mi, hi, w);
-                lo = hi;
-                i += 2 * w;
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+
+    // merge [i, ie) and [j, je) into k, and return the end of the output
+    template <typename I, typename J, typename K>
+    K mergeInto(I i, I ie, J j, J je, K k, const Comparator& cmp) {
+        while (i != ie && j != je) {
+            if (cmp(*j, *i)) {
+                *k++ = std::move(*j++);
+            } else {
+                *k++ = std::move(*i++);
             }
-            if (n + w > i) {
-                auto mi { lo + w };
-                auto hi { V.end() };
-                merge(lo, mi, hi, w);
+        }
+        return std::move(j, je, std::move(i, ie, k));
+    }
+
+    template <typename I, typename O>
+    void pass(I lo, std::size_t n, std::size_t w, O out, const Comparator& cmp) {
+        for (auto i { 0uz }; i < n; i += 2 * w) {
+            auto mi { lo + std::min(w, n - i) };
+            auto hi { mi + std::min(w, n - std::min(i + w, n)) };
+            out = mergeInto(lo, mi, mi, hi, out, cmp);
+            lo = hi;
+        }
+    }
+    void sort(L<T>& V, const Comparator& cmp) override {
+        auto n { V.size() };
+        Vector<T> W(n);
+        auto inW { false };
+        for (auto w { 1uz }; w < n; w *= 2, inW = !inW) {
+            if (inW) {
+                pass(W.begin(), n, w, V.begin(), cmp);
+            } else {
+                pass(V.begin(), n, w, W.begin(), cmp);
             }
         }
+        if (inW) {
+            std::move(W.begin(), W.end(), V.begin());
+        }
     }
 public:
     std::string type_name() const override {
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "AbstractSort.hpp"
+#include <thread>
+#include <vector>
+
+namespace dslab::sort {
+
+// merge sort on several threads, for vectors (the elements are contiguous)
+// - the two halves are sorted at the same time, each one by half of the threads (fork-join)
+// - the two sorted halves are merged by all the threads of the call: the output is cut into equal pieces,
+//   and the inputs of each piece are found by co-ranking (a binary search), so every piece is merged on its own
+// the halves and the merges alternate between V and a buffer of n elements, so nothing is copied back
+// ranges of at most GRAIN elements are sorted (and merged) by a single thread, like MergeSort
+// the sort is stable, and the result does not depend on the number of threads
+template <typename T, template<typename> typename L>
+requires std::is_base_of_v<AbstractVector<T>, L<T>>
+class ParallelMergeSort : public AbstractSort<T, L> {
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+
+    std::size_t m_threads;
+    std::size_t m_grain;
+
+    // the number of elements of a that are among the first k elements of the merge of a (la) and b (lb)
+    // the elements of a come first among equal ones
+    std::size_t corank(const T* a, std::size_t la, const T* b, std::size_t lb, std::size_t k, const Comparator& cmp) {
+        auto lo { k > lb ? k - lb : 0 }, hi { std::min(k, la) };
+        while (lo < hi) {
+            // a[i] is among the first k if fewer than k - i elements of b are less than it
+            auto i { lo + (hi - lo) / 2 };
+            if (!cmp(b[k - 1 - i], a[i])) {
+                lo = i + 1;
+            } else {
+                hi = i;
+            }
+        }
+        return lo;
+    }
+
+    // merge [i, ie) and [j, je) into k, [j, je) may already be at the end of the output (a merge in place)
+    void mergeInto(T* i, T* ie, T* j, T* je, T* k, const Comparator& cmp) {
+        while (i != ie && j != je) {
+            if (cmp(*j, *i)) {
+                *k++ = std::move(*j++);
+            } else {
+                *k++ = std::move(*i++);
+            }
+        }
+        k = std::move(i, ie, k);
+        if (k != j) {
+            std::move(j, je, k);
+        }
+    }
+
+    // merge a (la) and b (lb) into out, by up to threads threads
+    void merge(T* a, std::size_t la, T* b, std::size_t lb, T* out, std::size_t threads, const Comparator& cmp) {
+        auto n { la + lb };
+        auto pieces { std::min(threads, n / m_grain) };
+        if (pieces <= 1) {
+            mergeInto(a, a + la, b, b + lb, out, cmp);
+            return;
+        }
+        // the cuts are found before any piece is merged, since merging moves the elements out of a and b
+        std::vector<std::size_t> k(pieces + 1), i(pieces + 1);
+        for (auto p { 0uz }; p <= pieces; ++p) {
+            k[p] = n * p / pieces;
+            i[p] = corank(a, la, b, lb, k[p], cmp);
+        }
+        auto piece { [&](std::size_t p) {
+            mergeInto(a + i[p], a + i[p + 1], b + k[p] - i[p], b + k[p + 1] - i[p + 1], out + k[p], cmp);
+        } };
+        std::vector<std::jthread> workers {};
+        for (auto p { 1uz }; p < pieces; ++p) {
+            workers.emplace_back(piece, p);
+        }
+        piece(0);
+    }
+
+    // the sequential path: MergeSort with w as the buffer of the left parts
+    void mergeSort(T* a, std::size_t n, T* w, const Comparator& cmp) {
+        if (n < 2) return;
+        auto mi { n / 2 };
+        mergeSort(a, mi, w, cmp);
+        mergeSort(a + mi, n - mi, w, cmp);
+        mergeInto(w, std::move(a, a + mi, w), a + mi, a + n, a, cmp);
+    }
+
+    // sort a (n elements), the result ends in a, or in w if toBuffer (w has room for n elements)
+    void sort(T* a, T* w, std::size_t n, std::size_t threads, bool toBuffer, const Comparator& cmp) {
+        if (threads <= 1 || n <= m_grain) {
+            mergeSort(a, n, w, cmp);
+            if (toBuffer) {
+                std::move(a, a + n, w);
+            }
+            return;
+        }
+        auto mi { n / 2 };
+        {
+            // the halves end in the other array, and are merged back into this one
+            std::jthread left { [&] { sort(a, w, mi, threads / 2, !toBuffer, cmp); } };
+            sort(a + mi, w + mi, n - mi, threads - threads / 2, !toBuffer, cmp);
+        }
+        auto [src, dst] { toBuffer ? std::pair { a, w } : std::pair { w, a } };
+        merge(src, mi, src + mi, n - mi, dst, threads, cmp);
+    }
+
+protected:
+    void sort(L<T>& V, const Comparator& cmp) override {
+        auto n { V.size() };
+        if (n < 2) return;
+        if (m_threads == 1 || n <= m_grain) {
+            // the sequential path only needs room for a left part
+            Vector<T> W(n / 2);
+            mergeSort(std::to_address(V.begin()), n, std::to_address(W.begin()), cmp);
+            return;
+        }
+        Vector<T> W(n);
+        sort(std::to_address(V.begin()), std::to_address(W.begin()), n, m_threads, false, cmp);
+    }
+
+public:
+    static constexpr std::size_t GRAIN { 1uz << 14 };
+
+    explicit ParallelMergeSort(std::size_t threads = std::thread::hardware_concurrency(), std::size_t grain = GRAIN)
+        : m_threads { std::max(threads, 1uz) }, m_grain { std::max(grain, 2uz) } {}
+
+    std::size_t threads() const {
+        return m_threads;
+    }
+
+    std::string type_name() const override {
+        return std::format("Merge Sort (Parallel, {} threads)", m_threads);
+    }
+};
+
+}
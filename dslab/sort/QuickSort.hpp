@@ -0,0 +1,282 @@
+#pragma once
+
+#include "AbstractSort.hpp"
+#include "../heap/Heap.hpp"
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+namespace dslab::sort {
+
+// pattern-defeating quicksort (Peters), unstable and in place, for vectors (the elements are contiguous)
+// - the pivot is the median of 3 elements, or the median of 3 medians of 3 (ninther) for large ranges
+// - arithmetic elements are partitioned by blocks: the comparisons of a block only record the offsets of the
+//   misplaced elements (without branches), and the recorded elements are swapped afterwards
+// - a partition that found no element to swap hints that the range is sorted, so both sides are tried with an
+//   insertion sort that gives up after a few moves
+// - a range equal to the pivot before it (all its elements are not less) is partitioned the other way,
+//   which puts the equal elements on the left and skips them, so many equal elements take linear time
+// - a very unbalanced partition shuffles a few elements, and after log n of them the range is heap sorted,
+//   which bounds the time by O(n log n)
+template <typename T, template<typename> typename L>
+requires std::is_base_of_v<AbstractVector<T>, L<T>>
+class QuickSort : public AbstractSort<T, L> {
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+
+    static constexpr std::size_t INSERTION_SORT_THRESHOLD { 24 };
+    static constexpr std::size_t NINTHER_THRESHOLD { 128 };
+    static constexpr std::size_t PARTIAL_INSERTION_SORT_LIMIT { 8 };
+    static constexpr std::size_t BLOCK_SIZE { 64 };
+    static constexpr bool BRANCHLESS { std::is_arithmetic_v<T> };
+
+    // an unguarded sort (not Guarded) relies on the element before first to stop, it is not greater than any element of the range
+    template <bool Guarded>
+    void insertionSort(T* first, T* last, const Comparator& cmp) {
+        if (first == last) return;
+        for (auto cur { first + 1 }; cur != last; ++cur) {
+            if (cmp(*cur, *(cur - 1))) {
+                T tmp { std::move(*cur) };
+                auto sift { cur };
+                do {
+                    *sift = std::move(*(sift - 1));
+                    --sift;
+                } while ((!Guarded || sift != first) && cmp(tmp, *(sift - 1)));
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    // insertion sort that gives up (and returns false) after moving more than PARTIAL_INSERTION_SORT_LIMIT elements
+    bool partialInsertionSort(T* first, T* last, const Comparator& cmp) {
+        if (first == last) return true;
+        auto moved { 0uz };
+        for (auto cur { first + 1 }; cur != last; ++cur) {
+            if (moved > PARTIAL_INSERTION_SORT_LIMIT) return false;
+            if (cmp(*cur, *(cur - 1))) {
+                T tmp { std::move(*cur) };
+                auto sift { cur };
+                do {
+                    *sift = std::move(*(sift - 1));
+                    --sift;
+                } while (sift != first && cmp(tmp, *(sift - 1)));
+                *sift = std::move(tmp);
+                moved += cur - sift;
+            }
+        }
+        return true;
+    }
+
+    void sort2(T* a, T* b, const Comparator& cmp) {
+        if (cmp(*b, *a)) {
+            std::iter_swap(a, b);
+        }
+    }
+    void sort3(T* a, T* b, T* c, const Comparator& cmp) {
+        sort2(a, b, cmp);
+        sort2(b, c, cmp);
+        sort2(a, b, cmp);
+    }
+
+    // swap the elements first + ol[i] and last - or[i], i < n
+    // if they are not paired one to one, they are moved around a cycle instead (one move per element, not three)
+    void swapOffsets(T* first, T* last, const std::uint8_t* ol, const std::uint8_t* orr, std::size_t n, bool useSwaps) {
+        if (useSwaps) {
+            for (auto i { 0uz }; i < n; ++i) {
+                std::iter_swap(first + ol[i], last - orr[i]);
+            }
+        } else if (n > 0) {
+            auto l { first + ol[0] };
+            auto r { last - orr[0] };
+            T tmp { std::move(*l) };
+            *l = std::move(*r);
+            for (auto i { 1uz }; i < n; ++i) {
+                l = first + ol[i];
+                *r = std::move(*l);
+                r = last - orr[i];
+                *l = std::move(*r);
+            }
+            *r = std::move(tmp);
+        }
+    }
+
+    // partition [begin, end) around *begin, the elements equal to the pivot go right
+    // returns the position of the pivot, and whether no element had to be moved
+    std::pair<T*, bool> partitionRight(T* begin, T* end, const Comparator& cmp) {
+        T pivot { std::move(*begin) };
+        auto first { begin }, last { end };
+        // the median of 3 guarantees an element not less than the pivot on the right, unless there is none
+        while (cmp(*++first, pivot)) {}
+        if (first - 1 == begin) {
+            while (first < last && !cmp(*--last, pivot)) {}
+        } else {
+            while (!cmp(*--last, pivot)) {}
+        }
+        auto partitioned { first >= last };
+        if constexpr (BRANCHLESS) {
+            if (!partitioned) {
+                std::iter_swap(first, last);
+                ++first;
+                partitionBlocks(first, last, pivot, cmp);
+            }
+        } else {
+            while (first < last) {
+                std::iter_swap(first, last);
+                while (cmp(*++first, pivot)) {}
+                while (!cmp(*--last, pivot)) {}
+            }
+        }
+        auto pivotPos { first - 1 };
+        *begin = std::move(*pivotPos);
+        *pivotPos = std::move(pivot);
+        return { pivotPos, partitioned };
+    }
+
+    // the block partition of [first, last), after which first is the start of the right side
+    void partitionBlocks(T*& first, T*& last, const T& pivot, const Comparator& cmp) {
+        alignas(64) std::uint8_t offsetsL[BLOCK_SIZE], offsetsR[BLOCK_SIZE];
+        auto baseL { first }, baseR { last };
+        auto numL { 0uz }, numR { 0uz }, startL { 0uz }, startR { 0uz };
+        while (first < last) {
+            // fill the blocks that are empty, splitting what is left if both are
+            auto unknown { static_cast<std::size_t>(last - first) };
+            auto splitL { numL == 0 ? (numR == 0 ? unknown / 2 : unknown) : 0 };
+            auto splitR { numR == 0 ? unknown - splitL : 0 };
+            for (auto i { 0uz }, n { std::min(splitL, BLOCK_SIZE) }; i < n; ++i) {
+                offsetsL[numL] = static_cast<std::uint8_t>(i);
+                numL += !cmp(*first, pivot);
+                ++first;
+            }
+            for (auto i { 0uz }, n { std::min(splitR, BLOCK_SIZE) }; i < n;) {
+                offsetsR[numR] = static_cast<std::uint8_t>(++i);
+                numR += cmp(*--last, pivot);
+            }
+            auto n { std::min(numL, numR) };
+            swapOffsets(baseL, baseR, offsetsL + startL, offsetsR + startR, n, numL == numR);
+            numL -= n;
+            numR -= n;
+            startL += n;
+            startR += n;
+            if (numL == 0) {
+                startL = 0;
+                baseL = first;
+            }
+            if (numR == 0) {
+                startR = 0;
+                baseR = last;
+            }
+        }
+        // one of the blocks may have misplaced elements left, they are swapped to the boundary
+        if (numL > 0) {
+            while (numL-- > 0) {
+                std::iter_swap(baseL + offsetsL[startL + numL], --last);
+            }
+            first = last;
+        }
+        if (numR > 0) {
+            while (numR-- > 0) {
+                std::iter_swap(baseR - offsetsR[startR + numR], first);
+                ++first;
+            }
+        }
+    }
+
+    // partition [begin, end) around *begin, the elements equal to the pivot go left
+    // used when the pivot equals the element before the range, so the left side is all equal to it
+    T* partitionLeft(T* begin, T* end, const Comparator& cmp) {
+        T pivot { std::move(*begin) };
+        auto first { begin }, last { end };
+        while (cmp(pivot, *--last)) {}
+        if (last + 1 == end) {
+            while (first < last && !cmp(pivot, *++first)) {}
+        } else {
+            while (!cmp(pivot, *++first)) {}
+        }
+        while (first < last) {
+            std::iter_swap(first, last);
+            while (cmp(pivot, *--last)) {}
+            while (!cmp(pivot, *++first)) {}
+        }
+        *begin = std::move(*last);
+        *last = std::move(pivot);
+        return last;
+    }
+
+    // the left side is sorted by recursion and the right side by the loop, badAllowed unbalanced partitions are allowed
+    void quickSort(T* begin, T* end, int badAllowed, bool leftmost, const Comparator& cmp) {
+        while (true) {
+            auto size { static_cast<std::size_t>(end - begin) };
+            if (size < INSERTION_SORT_THRESHOLD) {
+                if (leftmost) {
+                    insertionSort<true>(begin, end, cmp);
+                } else {
+                    insertionSort<false>(begin, end, cmp);
+                }
+                return;
+            }
+            // the pivot is moved to begin
+            auto half { size / 2 };
+            if (size > NINTHER_THRESHOLD) {
+                sort3(begin, begin + half, end - 1, cmp);
+                sort3(begin + 1, begin + half - 1, end - 2, cmp);
+                sort3(begin + 2, begin + half + 1, end - 3, cmp);
+                sort3(begin + half - 1, begin + half, begin + half + 1, cmp);
+                std::iter_swap(begin, begin + half);
+            } else {
+                sort3(begin + half, begin, end - 1, cmp);
+            }
+            if (!leftmost && !cmp(*(begin - 1), *begin)) {
+                begin = partitionLeft(begin, end, cmp) + 1;
+                continue;
+            }
+            auto [pivotPos, partitioned] { partitionRight(begin, end, cmp) };
+            auto sizeL { static_cast<std::size_t>(pivotPos - begin) }, sizeR { static_cast<std::size_t>(end - pivotPos - 1) };
+            if (sizeL < size / 8 || sizeR < size / 8) {
+                if (--badAllowed == 0) {
+                    heap::Heap<2>::sort(begin, size, cmp);
+                    return;
+                }
+                // break the pattern that made the partition unbalanced
+                if (sizeL >= INSERTION_SORT_THRESHOLD) {
+                    std::iter_swap(begin, begin + sizeL / 4);
+                    std::iter_swap(pivotPos - 1, pivotPos - sizeL / 4);
+                    if (sizeL > NINTHER_THRESHOLD) {
+                        std::iter_swap(begin + 1, begin + (sizeL / 4 + 1));
+                        std::iter_swap(begin + 2, begin + (sizeL / 4 + 2));
+                        std::iter_swap(pivotPos - 2, pivotPos - (sizeL / 4 + 1));
+                        std::iter_swap(pivotPos - 3, pivotPos - (sizeL / 4 + 2));
+                    }
+                }
+                if (sizeR >= INSERTION_SORT_THRESHOLD) {
+                    std::iter_swap(pivotPos + 1, pivotPos + (1 + sizeR / 4));
+                    std::iter_swap(end - 1, end - sizeR / 4);
+                    if (sizeR > NINTHER_THRESHOLD) {
+                        std::iter_swap(pivotPos + 2, pivotPos + (2 + sizeR / 4));
+                        std::iter_swap(pivotPos + 3, pivotPos + (3 + sizeR / 4));
+                        std::iter_swap(end - 2, end - (1 + sizeR / 4));
+                        std::iter_swap(end - 3, end - (2 + sizeR / 4));
+                    }
+                }
+            } else if (partitioned && partialInsertionSort(begin, pivotPos, cmp) && partialInsertionSort(pivotPos + 1, end, cmp)) {
+                return;
+            }
+            quickSort(begin, pivotPos, badAllowed, leftmost, cmp);
+            begin = pivotPos + 1;
+            leftmost = false;
+        }
+    }
+
+protected:
+    void sort(L<T>& V, const Comparator& cmp) override {
+        auto n { V.size() };
+        if (n < 2) return;
+        auto first { std::to_address(V.begin()) };
+        quickSort(first, first + n, std::bit_width(n), true, cmp);
+    }
+
+public:
+    std::string type_name() const override {
+        return "Quick Sort (pdqsort)";
+    }
+};
+
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include "AbstractSort.hpp"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dslab::sort {
+
+// radix sort by an integer key, for vectors (the elements are contiguous)
+// the key of an element is key(x), the element itself by default, and a signed key has its sign bit flipped,
+// so the order of the unsigned digits is the order of the keys; the comparator is not used
+// - LSD: the digits are counted in a single pass over the input, then the elements are moved to the buffer and back,
+//   one stable pass per digit from the lowest one; a digit that is the same for all the elements is skipped,
+//   so small keys in wide types (like indices in std::size_t) take as many passes as their significant digits
+// - MSD, for at least MSD_THRESHOLD elements: the elements are permuted in place into the buckets of their highest byte
+//   (American flag sort), and the buckets are sorted on their own by the lower bytes, handed out to the threads;
+//   it needs no buffer, but it is not stable, so it is only used when the key is the element itself
+//   (equal keys are then equal elements), and a sort by a key extractor always takes the stable LSD path
+template <typename T, template<typename> typename L, typename Key = std::identity>
+requires std::is_base_of_v<AbstractVector<T>, L<T>>
+    && std::integral<std::remove_cvref_t<std::invoke_result_t<const Key&, const T&>>>
+class RadixSort : public AbstractSort<T, L> {
+    using K = std::remove_cvref_t<std::invoke_result_t<const Key&, const T&>>;
+    using U = std::make_unsigned_t<K>;
+
+    static constexpr std::size_t KEY_BITS { std::numeric_limits<U>::digits };
+
+    // the digits of MSD, and the buckets it leaves to insertion sort
+    static constexpr std::size_t MSD_BITS { 8 };
+    static constexpr std::size_t MSD_RADIX { 1uz << MSD_BITS };
+    static constexpr std::size_t SMALL { 64 };
+
+    // whether the order of equal keys cannot be seen, so the unstable MSD may be used
+    static constexpr bool UNSTABLE_OK { std::is_same_v<Key, std::identity> };
+
+    Key m_key;
+    std::size_t m_bits;
+    std::size_t m_threads;
+    std::size_t m_msdThreshold;
+
+    U key(const T& x) const {
+        auto k { static_cast<U>(std::invoke(m_key, x)) };
+        if constexpr (std::is_signed_v<K>) {
+            k ^= U { 1 } << (KEY_BITS - 1);
+        }
+        return k;
+    }
+
+    std::size_t digit(const T& x, std::size_t shift, std::size_t mask) const {
+        return static_cast<std::size_t>(key(x) >> shift) & mask;
+    }
+
+    // 8 bits while the counts would outnumber the elements, 16 bits when it is the whole key, 11 bits otherwise
+    std::size_t digitBits(std::size_t n) const {
+        if (m_bits > 0) {
+            return std::min(m_bits, KEY_BITS);
+        } else if (KEY_BITS <= 8 || n < (1uz << 16)) {
+            return 8;
+        } else if (KEY_BITS == 16) {
+            return 16;
+        } else {
+            return 11;
+        }
+    }
+
+    void insertionSort(T* a, std::size_t n) {
+        for (auto i { 1uz }; i < n; ++i) {
+            auto k { key(a[i]) };
+            if (k < key(a[i - 1])) {
+                T tmp { std::move(a[i]) };
+                auto j { i };
+                do {
+                    a[j] = std::move(a[j - 1]);
+                    --j;
+                } while (j > 0 && k < key(a[j - 1]));
+                a[j] = std::move(tmp);
+            }
+        }
+    }
+
+    void lsd(T* a, std::size_t n) {
+        auto bits { digitBits(n) };
+        auto radix { 1uz << bits }, mask { radix - 1 }, digits { (KEY_BITS + bits - 1) / bits };
+        // count[d * radix + b] is the number of elements whose digit d is b, then where the next one goes
+        std::vector<std::size_t> count(digits * radix);
+        for (auto i { 0uz }; i < n; ++i) {
+            auto k { key(a[i]) };
+            for (auto d { 0uz }; d < digits; ++d) {
+                ++count[d * radix + (static_cast<std::size_t>(k >> (d * bits)) & mask)];
+            }
+        }
+        std::vector<std::size_t> passes {};
+        for (auto d { 0uz }; d < digits; ++d) {
+            if (count[d * radix + digit(a[0], d * bits, mask)] != n) {
+                passes.push_back(d);
+            }
+        }
+        if (passes.empty()) return;
+        Vector<T> W(n);
+        T *src { a }, *dst { std::to_address(W.begin()) };
+        for (auto d : passes) {
+            auto pos { count.data() + d * radix };
+            for (auto b { 0uz }, sum { 0uz }; b < radix; ++b) {
+                sum += std::exchange(pos[b], sum);
+            }
+            for (auto i { 0uz }; i < n; ++i) {
+                dst[pos[digit(src[i], d * bits, mask)]++] = std::move(src[i]);
+            }
+            std::swap(src, dst);
+        }
+        if (src != a) {
+            std::move(src, src + n, a);
+        }
+    }
+
+    // move every element to the bucket of its digit, in place: each element taken out of a bucket is put in the next free
+    // place of its own bucket, and the element found there goes on the same way, until one belongs to the first bucket
+    // returns where the buckets start
+    std::array<std::size_t, MSD_RADIX + 1> permute(T* a, const std::array<std::size_t, MSD_RADIX>& count, std::size_t shift) {
+        std::array<std::size_t, MSD_RADIX + 1> start {};
+        for (auto b { 0uz }; b < MSD_RADIX; ++b) {
+            start[b + 1] = start[b] + count[b];
+        }
+        auto next { start };
+        for (auto b { 0uz }; b < MSD_RADIX; ++b) {
+            while (next[b] < start[b + 1]) {
+                T x { std::move(a[next[b]]) };
+                for (auto d { digit(x, shift, MSD_RADIX - 1) }; d != b; d = digit(x, shift, MSD_RADIX - 1)) {
+                    std::swap(x, a[next[d]++]);
+                }
+                a[next[b]++] = std::move(x);
+            }
+        }
+        return start;
+    }
+
+    // sort a (n elements) by the byte at shift and the ones below it
+    void msd(T* a, std::size_t n, std::size_t shift) {
+        while (n >= SMALL) {
+            std::array<std::size_t, MSD_RADIX> count {};
+            for (auto i { 0uz }; i < n; ++i) {
+                ++count[digit(a[i], shift, MSD_RADIX - 1)];
+            }
+            if (count[digit(a[0], shift, MSD_RADIX - 1)] != n) {
+                auto start { permute(a, count, shift) };
+                if (shift > 0) {
+                    for (auto b { 0uz }; b < MSD_RADIX; ++b) {
+                        msd(a + start[b], count[b], shift - MSD_BITS);
+                    }
+                }
+                return;
+            }
+            if (shift == 0) return;
+            shift -= MSD_BITS;
+        }
+        insertionSort(a, n);
+    }
+
+    // the first level of msd, with the counting and the buckets on several threads
+    void parallelMsd(T* a, std::size_t n) {
+        auto shift { KEY_BITS - MSD_BITS };
+        std::array<std::size_t, MSD_RADIX> count {};
+        while (true) {
+            std::vector<std::array<std::size_t, MSD_RADIX>> counts(m_threads);
+            parallel(m_threads, [&](std::size_t c) {
+                for (auto i { n * c / m_threads }, end { n * (c + 1) / m_threads }; i < end; ++i) {
+                    ++counts[c][digit(a[i], shift, MSD_RADIX - 1)];
+                }
+            });
+            count = {};
+            for (const auto& c : counts) {
+                for (auto b { 0uz }; b < MSD_RADIX; ++b) {
+                    count[b] += c[b];
+                }
+            }
+            if (count[digit(a[0], shift, MSD_RADIX - 1)] != n) break;
+            if (shift == 0) return;
+            shift -= MSD_BITS;
+        }
+        auto start { permute(a, count, shift) };
+        if (shift == 0) return;
+        // the largest buckets first, so that the last ones to finish are small
+        std::array<std::size_t, MSD_RADIX> order {};
+        std::iota(order.begin(), order.end(), 0uz);
+        std::sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return count[x] > count[y]; });
+        parallel(MSD_RADIX, [&](std::size_t k) {
+            auto b { order[k] };
+            msd(a + start[b], count[b], shift - MSD_BITS);
+        });
+    }
+
+    // run f(0), ..., f(tasks - 1), each thread takes the next task when it is done with one
+    template <typename F>
+    void parallel(std::size_t tasks, F&& f) {
+        std::atomic<std::size_t> next { 0 };
+        auto work { [&] {
+            for (auto k { next++ }; k < tasks; k = next++) {
+                f(k);
+            }
+        } };
+        std::vector<std::jthread> workers {};
+        for (auto k { 1uz }; k < std::min(m_threads, tasks); ++k) {
+            workers.emplace_back(work);
+        }
+        work();
+    }
+
+protected:
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+
+    void sort(L<T>& V, const Comparator&) override {
+        auto n { V.size() };
+        auto a { std::to_address(V.begin()) };
+        if (n < SMALL) {
+            insertionSort(a, n);
+        } else if (UNSTABLE_OK && n >= m_msdThreshold) {
+            parallelMsd(a, n);
+        } else {
+            lsd(a, n);
+        }
+    }
+
+public:
+    static constexpr std::size_t MSD_THRESHOLD { 1uz << 24 };
+
+    // the order is the one of the keys, so a comparator is refused instead of being ignored
+    static constexpr bool USES_COMPARATOR { false };
+    using AbstractSort<T, L>::operator();
+    template <typename C>
+    void operator()(L<T>& V, C&& cmp) = delete;
+
+    // bits is the width of the LSD digits (8, 11 or 16), 0 to choose it from n and the width of the key
+    explicit RadixSort(Key key = {}, std::size_t bits = 0, std::size_t threads = std::thread::hardware_concurrency(),
+        std::size_t msdThreshold = MSD_THRESHOLD)
+        : m_key { std::move(key) }, m_bits { bits }, m_threads { std::max(threads, 1uz) }, m_msdThreshold { msdThreshold } {
+        if (bits != 0 && bits != 8 && bits != 11 && bits != 16) {
+            throw std::invalid_argument(std::format("RadixSort digits of {} bits, expected 8, 11 or 16", bits));
+        }
+    }
+
+    std::string type_name() const override {
+        if (m_bits > 0) {
+            return std::format("Radix Sort ({}-bit digits)", m_bits);
+        } else {
+            return "Radix Sort";
+        }
+    }
+};
+
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "AbstractSort.hpp"
+
+namespace dslab::sort {
+
+// an adaptive merge sort in the way of TimSort, for vectors (the elements are contiguous)
+// - the input is cut into natural runs, ascending or strictly descending (which are reversed, keeping it stable)
+// - a run shorter than minRun is extended to minRun elements by binary insertion sort
+// - the runs are pushed on a stack and merged as soon as their lengths break the rules below,
+//   so that runs of similar lengths are merged, and the stack has O(log n) runs
+// - a merge first skips the elements already in place at both ends (found by galloping), so runs that are in order
+//   are not merged at all, and the shorter run is moved to the buffer
+// - a merge that keeps taking from the same run switches to galloping, which finds how many elements to take at once
+// a sorted or reversed input takes n - 1 comparisons, a random one about as many as MergeSort
+template <typename T, template<typename> typename L>
+requires std::is_base_of_v<AbstractVector<T>, L<T>>
+class TimSort : public AbstractSort<T, L> {
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+
+    // inputs below this length are a single run sorted by binary insertion sort, and runs are at least half of it
+    static constexpr std::size_t MIN_MERGE { 64 };
+
+    // a merge starts galloping after this many elements in a row from the same run
+    static constexpr std::size_t MIN_GALLOP { 7 };
+
+    struct Run {
+        T* m_base;
+        std::size_t m_length;
+        bool operator==(const Run&) const = default;
+    };
+
+    // the state of a sort() call, with its comparator
+    struct State {
+        const Comparator& m_cmp;
+        Vector<Run> m_runs {};
+        Vector<T> m_buffer {};
+        std::size_t m_minGallop { MIN_GALLOP };
+    };
+
+    // a length between MIN_MERGE / 2 and MIN_MERGE, such that n / minRun is (a little below) a power of 2
+    static std::size_t minRun(std::size_t n) {
+        auto r { 0uz };
+        while (n >= MIN_MERGE) {
+            r |= n & 1;
+            n >>= 1;
+        }
+        return n + r;
+    }
+
+    // the length of the run starting at a (of at most n elements), a descending run is reversed
+    std::size_t countRun(T* a, std::size_t n, const Comparator& cmp) {
+        if (n < 2) return n;
+        auto i { 2uz };
+        if (cmp(a[1], a[0])) {
+            while (i < n && cmp(a[i], a[i - 1])) {
+                ++i;
+            }
+            std::reverse(a, a + i);
+        } else {
+            while (i < n && !cmp(a[i], a[i - 1])) {
+                ++i;
+            }
+        }
+        return i;
+    }
+
+    // sort a (n elements), whose first sorted elements are already sorted
+    void binaryInsertionSort(T* a, std::size_t n, std::size_t sorted, const Comparator& cmp) {
+        for (auto i { std::max(sorted, 1uz) }; i < n; ++i) {
+            // after the equal elements, to keep it stable
+            auto pos { std::upper_bound(a, a + i, a[i], std::cref(cmp)) };
+            T pivot { std::move(a[i]) };
+            std::move_backward(pos, a + i, a + i + 1);
+            *pos = std::move(pivot);
+        }
+    }
+
+    // the number of elements of p (n elements, sorted) that go before key:
+    // those less than key (Right = false), or not greater than key (Right = true, after the equal elements)
+    // galloping probes 1, 3, 7, 15, ... elements from the start (FromLeft) or from the end, then binary searches the last gap
+    template <bool Right, bool FromLeft>
+    std::size_t gallop(const T& key, const T* p, std::size_t n, const Comparator& cmp) {
+        auto before { [&](const T& x) { return Right ? !cmp(key, x) : cmp(x, key); } };
+        auto last { 0uz }, ofs { 1uz };
+        if constexpr (FromLeft) {
+            while (ofs <= n && before(p[ofs - 1])) {
+                last = ofs;
+                ofs = 2 * ofs + 1;
+            }
+            return std::partition_point(p + last, p + std::min(ofs, n), before) - p;
+        } else {
+            while (ofs <= n && !before(p[n - ofs])) {
+                last = ofs;
+                ofs = 2 * ofs + 1;
+            }
+            return std::partition_point(p + n - std::min(ofs, n), p + n - last, before) - p;
+        }
+    }
+
+    // merge a (la) with b (lb) which follows it, la <= lb, a[0] > b[0] and a[la - 1] > b[lb - 1]
+    // a is moved to the buffer and merged forward
+    void mergeLo(State& s, T* a, std::size_t la, T* b, std::size_t lb) {
+        auto tmp { std::to_address(s.m_buffer.begin()) };
+        std::move(a, a + la, tmp);
+        T *c1 { tmp }, *e1 { tmp + la }, *c2 { b }, *e2 { b + lb }, *dest { a };
+        mergeLoLoop(s, c1, e1, c2, e2, dest);
+        // the rest of b is in place already
+        std::move(c1, e1, dest);
+    }
+
+    void mergeLoLoop(State& s, T*& c1, T* e1, T*& c2, T* e2, T*& dest) {
+        const auto& cmp { s.m_cmp };
+        while (true) {
+            // one element at a time, until a run wins MIN_GALLOP times in a row
+            auto count1 { 0uz }, count2 { 0uz };
+            do {
+                if (cmp(*c2, *c1)) {
+                    *dest++ = std::move(*c2++);
+                    ++count2;
+                    count1 = 0;
+                    if (c2 == e2) return;
+                } else {
+                    *dest++ = std::move(*c1++);
+                    ++count1;
+                    count2 = 0;
+                    if (c1 == e1) return;
+                }
+            } while (std::max(count1, count2) < s.m_minGallop);
+            // galloping, while it takes long stretches
+            do {
+                count1 = gallop<true, true>(*c2, c1, e1 - c1, cmp);
+                dest = std::move(c1, c1 + count1, dest);
+                c1 += count1;
+                if (c1 == e1) return;
+                *dest++ = std::move(*c2++);
+                if (c2 == e2) return;
+                count2 = gallop<false, true>(*c1, c2, e2 - c2, cmp);
+                dest = std::move(c2, c2 + count2, dest);
+                c2 += count2;
+                if (c2 == e2) return;
+                *dest++ = std::move(*c1++);
+                if (c1 == e1) return;
+                s.m_minGallop -= s.m_minGallop > 1;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+            // galloping stopped paying off, make it harder to start again
+            s.m_minGallop += 2;
+        }
+    }
+
+    // the same with la > lb: b is moved to the buffer and merged backward, the cursors point after the elements
+    void mergeHi(State& s, T* a, std::size_t la, T* b, std::size_t lb) {
+        auto tmp { std::to_address(s.m_buffer.begin()) };
+        std::move(b, b + lb, tmp);
+        T *c1 { a + la }, *s1 { a }, *c2 { tmp + lb }, *s2 { tmp }, *dest { b + lb };
+        mergeHiLoop(s, c1, s1, c2, s2, dest);
+        // the rest of a is in place already
+        std::move_backward(s2, c2, dest);
+    }
+
+    void mergeHiLoop(State& s, T*& c1, T* s1, T*& c2, T* s2, T*& dest) {
+        const auto& cmp { s.m_cmp };
+        while (true) {
+            auto count1 { 0uz }, count2 { 0uz };
+            do {
+                // the last element of a goes last only if it is greater (equal elements of b come after it)
+                if (cmp(*(c2 - 1), *(c1 - 1))) {
+                    *--dest = std::move(*--c1);
+                    ++count1;
+                    count2 = 0;
+                    if (c1 == s1) return;
+                } else {
+                    *--dest = std::move(*--c2);
+                    ++count2;
+                    count1 = 0;
+                    if (c2 == s2) return;
+                }
+            } while (std::max(count1, count2) < s.m_minGallop);
+            do {
+                // the elements of a greater than the last of b
+                count1 = (c1 - s1) - gallop<true, false>(*(c2 - 1), s1, c1 - s1, cmp);
+                dest = std::move_backward(c1 - count1, c1, dest);
+                c1 -= count1;
+                if (c1 == s1) return;
+                *--dest = std::move(*--c2);
+                if (c2 == s2) return;
+                // the elements of b not less than the last of a
+                count2 = (c2 - s2) - gallop<false, false>(*(c1 - 1), s2, c2 - s2, cmp);
+                dest = std::move_backward(c2 - count2, c2, dest);
+                c2 -= count2;
+                if (c2 == s2) return;
+                *--dest = std::move(*--c1);
+                if (c1 == s1) return;
+                s.m_minGallop -= s.m_minGallop > 1;
+            } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+            s.m_minGallop += 2;
+        }
+    }
+
+    // merge runs i and i + 1 of the stack
+    void mergeAt(State& s, std::size_t i) {
+        auto [a, la] { s.m_runs[i] };
+        auto [b, lb] { s.m_runs[i + 1] };
+        s.m_runs[i].m_length = la + lb;
+        s.m_runs.erase(s.m_runs.begin() + i + 1);
+        // the elements of a not greater than b[0] are in place
+        auto k { gallop<true, true>(*b, a, la, s.m_cmp) };
+        a += k;
+        la -= k;
+        if (la == 0) return;
+        // the elements of b not less than the last of a are in place
+        lb = gallop<false, false>(a[la - 1], b, lb, s.m_cmp);
+        if (lb == 0) return;
+        if (s.m_buffer.size() < std::min(la, lb)) {
+            s.m_buffer.resize(std::min(la, lb));
+        }
+        if (la <= lb) {
+            mergeLo(s, a, la, b, lb);
+        } else {
+            mergeHi(s, a, la, b, lb);
+        }
+    }
+
+    // the lengths A, B, C of the top three runs (C on top) must keep A > B + C and B > C,
+    // the two shorter neighbours are merged until they do (the fourth run is checked too)
+    void collapse(State& s) {
+        while (s.m_runs.size() > 1) {
+            auto n { s.m_runs.size() - 2 };
+            auto len { [&](std::size_t i) { return s.m_runs[i].m_length; } };
+            if ((n > 0 && len(n - 1) <= len(n) + len(n + 1)) || (n > 1 && len(n - 2) <= len(n - 1) + len(n))) {
+                if (len(n - 1) < len(n + 1)) {
+                    --n;
+                }
+            } else if (len(n) > len(n + 1)) {
+                break;
+            }
+            mergeAt(s, n);
+        }
+    }
+
+    void forceCollapse(State& s) {
+        while (s.m_runs.size() > 1) {
+            auto n { s.m_runs.size() - 2 };
+            if (n > 0 && s.m_runs[n - 1].m_length < s.m_runs[n + 1].m_length) {
+                --n;
+            }
+            mergeAt(s, n);
+        }
+    }
+
+protected:
+    void sort(L<T>& V, const Comparator& cmp) override {
+        auto n { V.size() };
+        if (n < 2) return;
+        auto a { std::to_address(V.begin()) };
+        if (n < MIN_MERGE) {
+            binaryInsertionSort(a, n, countRun(a, n, cmp), cmp);
+            return;
+        }
+        State s { cmp };
+        auto min { minRun(n) };
+        for (auto lo { 0uz }; lo < n;) {
+            auto length { countRun(a + lo, n - lo, cmp) };
+            if (length < min) {
+                auto forced { std::min(min, n - lo) };
+                binaryInsertionSort(a + lo, forced, length, cmp);
+                length = forced;
+            }
+            s.m_runs.push_back({ a + lo, length });
+            collapse(s);
+            lo += length;
+        }
+        forceCollapse(s);
+    }
+
+public:
+    std::string type_name() const override {
+        return "Merge Sort (TimSort)";
+    }
+};
+
+}
@@ -15,7 +15,8 @@ public:
     Stack(const Stack& other) = default;
     Stack(Stack&& other) noexcept = default;
     Stack& operator=(const Stack& other) = default;
-    Stack& operator=(Stack&& other) noexcept = default;
+    // noexcept only if the move assignment of L is (that of Vector is not, see Vector::operator=(Vector&&))
+    Stack& operator=(Stack&& other) = default;
 
     Stack(std::initializer_list<T> ilist) : V(ilist) {}
     Stack& operator=(std::initializer_list<T> ilist) {
@@ -6,6 +6,7 @@
 
 namespace dslab::stack::expression {
 
+// the working stacks of the algorithms below use the same kind of list as the expression itself
 template <typename T = int, template<typename> typename L = DefaultVector>
 class Expression : public L<ExpressionElement<T>> {
     using L<ExpressionElement<T>>::push_back;
@@ -37,8 +38,8 @@ public:
     }
 
     void infix2suffix() {
-        Stack<ExpressionElement<T>> S;
-        Expression<T> suffix;
+        Stack<ExpressionElement<T>, L> S;
+        Expression<T, L> suffix;
         auto process { [&](const ExpressionElement<T>& e) {
             while (!S.empty() && S.top().prior(e.getOperator())) {
                 if (auto op { S.pop() }; op != '(') {
@@ -63,8 +64,8 @@ public:
     }
 
     T calInfix() const {
-        Stack<T> Sr;
-        Stack<ExpressionElement<T>> So;
+        Stack<T, L> Sr;
+        Stack<ExpressionElement<T>, L> So;
         auto process { [&](const ExpressionElement<T>& e) {
             while (!So.empty() && So.top().prior(e.getOperator())) {
                 if (auto op { So.pop() }; op != '(') {
@@ -92,7 +93,7 @@ public:
     }
 
     T calSuffix() const {
-        Stack<T> S;
+        Stack<T, L> S;
         for (auto& e : *this) {
             if (e.isOperand()) {
                 S.push(e.getOperand());
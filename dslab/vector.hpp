@@ -2,9 +2,22 @@
 
 #include "vector/AbstractVector.hpp"
 #include "vector/VectorAllocator.hpp"
+#include "vector/VectorMemory.hpp"
+#include "vector/VectorHugeMemory.hpp"
+#include "vector/VectorFind.hpp"
+#include "vector/VectorShift.hpp"
+#include "vector/VectorStats.hpp"
+#include "vector/VectorRotate.hpp"
+#include "vector/VectorShuffle.hpp"
+#include "vector/VectorFile.hpp"
+#include "vector/MappedVector.hpp"
 #include "vector/LinearList.hpp"
 #include "vector/Vector.hpp"
+#include "vector/FinalVector.hpp"
+#include "vector/SmallVector.hpp"
+#include "vector/SegmentedVector.hpp"
 #include "vector/VectorIterator.hpp"
+#include "vector/SegmentedVectorIterator.hpp"
 #include "vector/VectorFormatter.hpp"
 
 namespace dslab {
@@ -12,4 +25,10 @@ namespace dslab {
 
     template <typename T>
     using DefaultVector = Vector<T, VectorAllocatorGP<std::ratio<3, 2>>>;
+
+    template <typename T>
+    using DefaultFinalVector = FinalVector<T, VectorAllocatorGP<std::ratio<3, 2>>>;
+
+    template <typename T>
+    using DefaultSmallVector = SmallVector<T, 16, VectorAllocatorGP<std::ratio<3, 2>>>;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "LinearList.hpp"
 #include "VectorIterator.hpp"
+#include "VectorFind.hpp"
 
 namespace dslab::vector {
 
@@ -15,6 +16,7 @@ public:
     using value_type = T;
     using iterator = VectorIterator<AbstractVector<T>>;
     using const_iterator = ConstVectorIterator<AbstractVector<T>>;
+    static_assert(std::contiguous_iterator<iterator> && std::contiguous_iterator<const_iterator>);
 
     // return the capacity of the vector
     virtual std::size_t capacity() const = 0;
@@ -22,6 +24,9 @@ public:
     // reserve the capacity of the vector
     virtual void reserve(std::size_t n) = 0;
 
+    // reduce the capacity of the vector to its size
+    virtual void shrink_to_fit() = 0;
+
     // return the size of the vector (has been declared in DataStructure)
     virtual std::size_t size() const = 0;
 
@@ -42,30 +47,39 @@ public:
         resize(0);
     }
 
+    // arithmetic elements are compared with SIMD instructions, see VectorFind
+    iterator find(const T& e) const override {
+        auto first { const_cast<T*>(data()) }, last { first + size() };
+        if constexpr (VectorFind::supports<T>) {
+            return iterator { const_cast<T*>(VectorFind::find(first, last, e)) };
+        }
+        return iterator { std::find(first, last, e) };
+    }
+
     // iterator-related methods below
 
     iterator begin() noexcept override {
-        return iterator { this, 0 };
+        return iterator { data() };
     }
 
     iterator end() noexcept override {
-        return iterator { this, size() };
+        return iterator { data() + size() };
     }
 
     const_iterator begin() const noexcept {
-        return const_iterator { this, 0 };
+        return const_iterator { data() };
     }
 
     const_iterator end() const noexcept {
-        return const_iterator { this, size() };
+        return const_iterator { data() + size() };
     }
 
     const_iterator cbegin() const noexcept override {
-        return const_iterator { this, 0 };
+        return const_iterator { data() };
     }
 
     const_iterator cend() const noexcept override {
-        return const_iterator { this, size() };
+        return const_iterator { data() + size() };
     }
 
     using reverse_iterator = std::reverse_iterator<iterator>;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Vector.hpp"
+
+namespace dslab::vector {
+
+// a vector that cannot be derived from any more
+// it has the same storage and interface as Vector, but the hot methods are redeclared here
+// and work on the members directly, so a call through a FinalVector (or a template parameter bound to it)
+// is resolved at compile time and can be inlined, instead of going through the vtable
+// calls through an AbstractVector or a LinearList reference still dispatch dynamically as usual
+template <typename T, typename A = VectorAllocatorGP<std::ratio<3, 2>>, typename M = VectorMemory, typename S = VectorNoStats>
+    requires std::is_base_of_v<VectorAllocator, A>
+class FinalVector final : public Vector<T, A, M, S> {
+    using Base = Vector<T, A, M, S>;
+    using Base::m_data;
+    using Base::m_capacity;
+    using Base::m_size;
+    using Base::m_allocator;
+
+protected:
+    T* data() override { return m_data; }
+    const T* data() const override { return m_data; }
+
+    // grow the block for one more element at the end
+    void grow() {
+        Base::reserve(m_allocator(m_capacity, m_size));
+    }
+
+public:
+    using Base::Base;
+
+    FinalVector() = default;
+    FinalVector(const FinalVector& other) = default;
+    FinalVector(FinalVector&& other) noexcept = default;
+    FinalVector& operator=(const FinalVector& other) = default;
+    // not noexcept, moving from a vector on another resource allocates, see Vector::operator=(Vector&&)
+    FinalVector& operator=(FinalVector&& other) = default;
+
+    FinalVector& operator=(std::initializer_list<T> ilist) {
+        Base::operator=(ilist);
+        return *this;
+    }
+
+    std::size_t capacity() const override { return m_capacity; }
+    std::size_t size() const override { return m_size; }
+
+    void reserve(std::size_t n) override { Base::reserve(n); }
+    void resize(std::size_t n) override { Base::resize(n); }
+    void clear() override { Base::resize(0); }
+
+    T& operator[](std::size_t r) { return m_data[r]; }
+    const T& operator[](std::size_t r) const { return m_data[r]; }
+
+    using iterator = Base::iterator;
+    using const_iterator = Base::const_iterator;
+
+    iterator begin() noexcept override { return iterator { m_data }; }
+    iterator end() noexcept override { return iterator { m_data + m_size }; }
+    const_iterator begin() const noexcept { return const_iterator { m_data }; }
+    const_iterator end() const noexcept { return const_iterator { m_data + m_size }; }
+    const_iterator cbegin() const noexcept override { return const_iterator { m_data }; }
+    const_iterator cend() const noexcept override { return const_iterator { m_data + m_size }; }
+
+    T& front() { return m_data[0]; }
+    const T& front() const { return m_data[0]; }
+    T& back() { return m_data[m_size - 1]; }
+    const T& back() const { return m_data[m_size - 1]; }
+
+    // e may refer to an element of this vector, so it is copied out before the block moves
+    void push_back(const T& e) {
+        if (m_size == m_capacity) {
+            T tmp { e };
+            grow();
+            std::construct_at(m_data + m_size, std::move(tmp));
+        } else {
+            std::construct_at(m_data + m_size, e);
+        }
+        ++m_size;
+    }
+
+    void push_back(T&& e) {
+        if (m_size == m_capacity) {
+            T tmp { std::move(e) };
+            grow();
+            std::construct_at(m_data + m_size, std::move(tmp));
+        } else {
+            std::construct_at(m_data + m_size, std::move(e));
+        }
+        ++m_size;
+    }
+
+    T pop_back() {
+        T e { std::move(m_data[m_size - 1]) };
+        std::destroy_at(m_data + m_size - 1);
+        Base::truncate(m_size - 1);
+        return e;
+    }
+
+    // push_front and pop_front shift the whole vector anyway, so they keep the inherited versions
+    using Base::push_front;
+    using Base::pop_front;
+
+    std::string type_name() const override {
+        return std::format("Final Vector [{}]", m_allocator.type_name());
+    }
+
+};
+
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../framework.hpp"
+#include <iterator>
+#include <ranges>
 
 namespace dslab::vector {
 
@@ -16,9 +18,68 @@ namespace dslab::vector {
         virtual iterator insert(iterator p, const T& e) = 0;
         virtual iterator insert(iterator p, T&& e) = 0;
 
+        // insert n copies of e at position p, and return the position of the first new element
+        // the default inserts them one by one, the concrete lists make room for all of them at once
+        virtual iterator insert(iterator p, std::size_t n, const T& e) {
+            if (n == 0) {
+                return p;
+            }
+            auto q { insert(p, e) }, r { q };
+            for (auto i { 1uz }; i < n; ++i) {
+                r = insert(++r, e);
+            }
+            return q;
+        }
+
+        // insert the elements in [first, last) at position p, and return the position of the first new element
+        // the range must not come from this list
+        // the default inserts them one by one, the vectors hide it to make room once for a forward (or sized) range
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        iterator insert(iterator p, I first, S last) {
+            if (first == last) {
+                return p;
+            }
+            auto q { insert(p, *first) }, r { q };
+            while (++first != last) {
+                r = insert(++r, *first);
+            }
+            return q;
+        }
+
+        iterator insert(iterator p, std::initializer_list<T> ilist) {
+            return insert(p, ilist.begin(), ilist.end());
+        }
+
+        // insert the elements of r at the end
+        // this and assign call the insert above, the vectors hide all three so that they reach their own insert
+        template <std::ranges::input_range R>
+        void append_range(R&& r) {
+            insert(end(), std::ranges::begin(r), std::ranges::end(r));
+        }
+
+        // replace the content of the list with the elements in [first, last)
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        void assign(I first, S last) {
+            clear();
+            insert(end(), first, last);
+        }
+
+        void assign(std::initializer_list<T> ilist) {
+            assign(ilist.begin(), ilist.end());
+        }
+
         // remove the element at position p, and return the position of the removed element's successor
         virtual iterator erase(iterator p) = 0;
 
+        // remove the elements in [first, last), and return the position of the successor of the removed elements
+        // the default removes them one by one, the concrete lists close the gap at once
+        virtual iterator erase(iterator first, iterator last) {
+            for (auto n { std::distance(first, last) }; n > 0; --n) {
+                first = erase(first);
+            }
+            return first;
+        }
+
         // try to find the element e, and return the position of the first occurrence
         virtual iterator find(const T& e) const = 0;
 
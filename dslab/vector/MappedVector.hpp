@@ -0,0 +1,261 @@
+#pragma once
+
+#include "AbstractVector.hpp"
+#include "VectorFile.hpp"
+#include <algorithm>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dslab::vector {
+
+#ifdef __linux__
+
+// how a MappedVector shares the file
+// - ReadOnly: the pages are shared with the page cache (and with every other process mapping the file),
+//   the elements must not be written, and the methods changing the size throw
+// - CopyOnWrite: a page is copied on its first write, the file is not changed until write_back
+// - Shared: the writes go to the file (flushed by write_back or when the mapping ends), and it grows with the vector
+enum class MapMode { ReadOnly, CopyOnWrite, Shared };
+
+// a vector that uses a vector file (see VectorFile) in place
+// opening it maps the whole file and checks the header, no element is read or copied,
+// and a page of the file is only loaded when it is first accessed
+// the header is mapped with the elements, so the size in the header is the size of the vector
+template <typename T>
+class MappedVector : public AbstractVector<T> {
+    static_assert(VectorFile::supports<T>, "MappedVector needs trivially copyable elements");
+protected:
+    std::string m_path {};
+    MapMode m_mode { MapMode::ReadOnly };
+    int m_fd { -1 };
+    std::byte* m_base { nullptr };
+    std::size_t m_length { 0 };
+
+    VectorFileHeader* header() const { return reinterpret_cast<VectorFileHeader*>(m_base); }
+
+    // a moved-from vector has no mapping, it is empty
+    T* data() override { return m_base == nullptr ? nullptr : reinterpret_cast<T*>(m_base + VectorFile::HEADER_SIZE); }
+    const T* data() const override { return m_base == nullptr ? nullptr : reinterpret_cast<const T*>(m_base + VectorFile::HEADER_SIZE); }
+
+    void writable() const {
+        if (m_mode == MapMode::ReadOnly) {
+            throw std::logic_error("MappedVector is read-only");
+        }
+    }
+
+    static std::size_t length(std::size_t capacity) {
+        if (capacity > (std::numeric_limits<std::size_t>::max() - VectorFile::HEADER_SIZE) / sizeof(T)) {
+            throw std::length_error("MappedVector capacity exceeds the address space");
+        }
+        return VectorFile::HEADER_SIZE + capacity * sizeof(T);
+    }
+
+    // change the number of slots to n (n >= size)
+    // a shared file is resized and remapped, and a copy-on-write vector is copied to anonymous memory
+    // (the file may be shared with other processes, and a private mapping cannot extend past its end)
+    void remap(std::size_t n) {
+        auto len { length(n) };
+        if (m_mode == MapMode::Shared) {
+            if (ftruncate(m_fd, static_cast<off_t>(len)) != 0) {
+                throw std::runtime_error(std::format("cannot resize {}", m_path));
+            }
+            auto p { mremap(m_base, m_length, len, MREMAP_MAYMOVE) };
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc {};
+            }
+            m_base = static_cast<std::byte*>(p);
+        } else {
+            auto p { mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc {};
+            }
+            std::memcpy(p, m_base, length(size()));
+            munmap(m_base, m_length);
+            m_base = static_cast<std::byte*>(p);
+        }
+        m_length = len;
+        header()->m_capacity = n;
+    }
+
+    // make room for n more elements
+    void grow(std::size_t n) {
+        if (size() + n > capacity()) {
+            remap(std::max(size() + n, 2 * capacity()));
+        }
+    }
+
+    void unmap() noexcept {
+        if (m_base != nullptr) {
+            munmap(m_base, m_length);
+        }
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+        m_base = nullptr;
+        m_fd = -1;
+    }
+
+    void swap(MappedVector& other) noexcept {
+        std::swap(m_path, other.m_path);
+        std::swap(m_mode, other.m_mode);
+        std::swap(m_fd, other.m_fd);
+        std::swap(m_base, other.m_base);
+        std::swap(m_length, other.m_length);
+    }
+
+public:
+    using iterator = typename AbstractVector<T>::iterator;
+
+    // map an existing vector file, throw if it cannot be opened or does not hold elements of type T
+    MappedVector(const std::string& path, MapMode mode = MapMode::ReadOnly) : m_path(path), m_mode(mode) {
+        m_fd = open(path.c_str(), mode == MapMode::Shared ? O_RDWR : O_RDONLY);
+        if (m_fd < 0) {
+            throw std::runtime_error(std::format("cannot open vector file {}", path));
+        }
+        struct stat st {};
+        if (fstat(m_fd, &st) != 0) {
+            close(m_fd);
+            throw std::runtime_error(std::format("cannot stat vector file {}", path));
+        }
+        m_length = static_cast<std::size_t>(st.st_size);
+        if (m_length < VectorFile::HEADER_SIZE) {
+            close(m_fd);
+            throw std::runtime_error("not a vector file");
+        }
+        auto prot { mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE };
+        auto p { mmap(nullptr, m_length, prot, mode == MapMode::CopyOnWrite ? MAP_PRIVATE : MAP_SHARED, m_fd, 0) };
+        if (p == MAP_FAILED) {
+            close(m_fd);
+            throw std::runtime_error(std::format("cannot map vector file {}", path));
+        }
+        m_base = static_cast<std::byte*>(p);
+        try {
+            VectorFile::check<T>(*header(), m_length);
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    // create an empty vector file and map it
+    static MappedVector create(const std::string& path, std::size_t capacity = 0) {
+        VectorFile::save<T>(path, nullptr, 0);
+        MappedVector v { path, MapMode::Shared };
+        v.reserve(capacity);
+        return v;
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept {
+        swap(other);
+    }
+
+    MappedVector& operator=(MappedVector&& other) noexcept {
+        if (this != &other) {
+            MappedVector tmp { std::move(other) };
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    virtual ~MappedVector() {
+        unmap();
+    }
+
+    MapMode mode() const { return m_mode; }
+
+    std::size_t size() const override { return m_base == nullptr ? 0 : header()->m_size; }
+    std::size_t capacity() const override { return m_base == nullptr ? 0 : header()->m_capacity; }
+
+    void reserve(std::size_t n) override {
+        writable();
+        if (n > capacity()) {
+            remap(n);
+        }
+    }
+
+    // a shared file is cut to its elements, a copy-on-write or read-only vector keeps its mapping
+    void shrink_to_fit() override {
+        if (m_mode == MapMode::Shared && capacity() > size()) {
+            remap(size());
+        }
+    }
+
+    void resize(std::size_t n) override {
+        writable();
+        if (n > size()) {
+            grow(n - size());
+            std::uninitialized_value_construct(data() + size(), data() + n);
+        }
+        header()->m_size = n;
+    }
+
+    // make the changes permanent
+    // the writes to a shared mapping are flushed to the disk
+    // a copy-on-write vector is written to a new file that then replaces the file it was opened from,
+    // so that the pages it has not written are still read from the old file, and a reader sees either file
+    void write_back() {
+        if (m_mode == MapMode::Shared) {
+            if (msync(m_base, m_length, MS_SYNC) != 0) {
+                throw std::runtime_error(std::format("cannot write back {}", m_path));
+            }
+        } else if (m_mode == MapMode::CopyOnWrite) {
+            auto tmp { m_path + ".tmp" };
+            VectorFile::save<T>(tmp, data(), size());
+            if (std::rename(tmp.c_str(), m_path.c_str()) != 0) {
+                throw std::runtime_error(std::format("cannot write back {}", m_path));
+            }
+        }
+    }
+
+    using AbstractVector<T>::insert;
+    using AbstractVector<T>::erase;
+
+    iterator insert(iterator p, const T& e) override {
+        return insert(p, 1, e);
+    }
+
+    iterator insert(iterator p, T&& e) override {
+        return insert(p, 1, e);
+    }
+
+    iterator insert(iterator p, std::size_t n, const T& e) override {
+        writable();
+        auto r { static_cast<std::size_t>(p - this->begin()) };
+        T value { e };
+        grow(n);
+        std::memmove(data() + r + n, data() + r, (size() - r) * sizeof(T));
+        std::fill_n(data() + r, n, value);
+        header()->m_size += n;
+        return this->begin() + r;
+    }
+
+    iterator erase(iterator p) override {
+        return erase(p, p + 1);
+    }
+
+    iterator erase(iterator first, iterator last) override {
+        writable();
+        auto r { static_cast<std::size_t>(first - this->begin()) }, n { static_cast<std::size_t>(last - first) };
+        std::memmove(data() + r, data() + r + n, (size() - r - n) * sizeof(T));
+        header()->m_size -= n;
+        return first;
+    }
+
+    std::string type_name() const override {
+        constexpr const char* MODES[] { "read-only", "copy-on-write", "shared" };
+        return std::format("Mapped Vector ({})", MODES[static_cast<int>(m_mode)]);
+    }
+
+};
+
+#endif
+
+}
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "LinearList.hpp"
+#include "SegmentedVectorIterator.hpp"
+#include "VectorShift.hpp"
+#include <bit>
+
+namespace dslab::vector {
+
+// a vector made of chunks of geometrically growing size, which are never moved
+// chunk 0 holds the ranks in [0, F), and chunk k > 0 holds the ranks in [F * 2^(k-1), F * 2^k),
+// so the chunk of a rank is given by the bit width of rank / F, and random access takes O(1) time
+// growing only adds a chunk: the elements are never relocated, the references to them stay valid
+// (until the elements themselves are shifted by insert or erase), and no growth copies the whole vector
+template <typename T>
+class SegmentedVector : public LinearList<T, SegmentedVectorIterator<SegmentedVector<T>>, ConstSegmentedVectorIterator<SegmentedVector<T>>> {
+protected:
+    // the size of chunk 0, about 1 KiB and a power of 2
+    static constexpr std::size_t FIRST { std::bit_floor(std::max(1uz, 1024 / sizeof(T))) };
+    static constexpr std::size_t SHIFT { static_cast<std::size_t>(std::countr_zero(FIRST)) };
+
+    // the chunk map never grows, there are enough entries for the whole address space
+    static constexpr std::size_t CHUNKS { std::numeric_limits<std::size_t>::digits - SHIFT + 1 };
+
+    T* m_chunks[CHUNKS] {};
+    std::size_t m_chunkCount { 0 };
+    std::size_t m_size { 0 };
+
+    static std::size_t chunkOf(std::size_t r) {
+        return std::bit_width(r >> SHIFT);
+    }
+    // the first rank in chunk k, which is also the total size of chunks [0, k)
+    static std::size_t chunkBase(std::size_t k) {
+        return k == 0 ? 0 : FIRST << (k - 1);
+    }
+    static std::size_t chunkSize(std::size_t k) {
+        return k == 0 ? FIRST : FIRST << (k - 1);
+    }
+
+    T* address(std::size_t r) const {
+        auto k { chunkOf(r) };
+        return m_chunks[k] + (r - chunkBase(k));
+    }
+
+    // add chunks until the capacity reaches n
+    void addChunks(std::size_t n) {
+        while (capacity() < n) {
+            if (m_chunkCount == CHUNKS) {
+                throw std::length_error("SegmentedVector capacity exceeds the address space");
+            }
+            m_chunks[m_chunkCount] = std::allocator<T> {}.allocate(chunkSize(m_chunkCount));
+            ++m_chunkCount;
+        }
+    }
+
+    // free the chunks [k, m_chunkCount), they must hold no elements
+    void removeChunks(std::size_t k) {
+        while (m_chunkCount > k) {
+            --m_chunkCount;
+            std::allocator<T> {}.deallocate(m_chunks[m_chunkCount], chunkSize(m_chunkCount));
+            m_chunks[m_chunkCount] = nullptr;
+        }
+    }
+
+    void swap(SegmentedVector& other) noexcept {
+        std::swap(m_chunks, other.m_chunks);
+        std::swap(m_chunkCount, other.m_chunkCount);
+        std::swap(m_size, other.m_size);
+    }
+
+public:
+    using value_type = T;
+    using iterator = SegmentedVectorIterator<SegmentedVector<T>>;
+    using const_iterator = ConstSegmentedVectorIterator<SegmentedVector<T>>;
+    static_assert(std::random_access_iterator<iterator> && std::random_access_iterator<const_iterator>);
+
+    std::size_t size() const override { return m_size; }
+    std::size_t capacity() const { return chunkBase(m_chunkCount); }
+
+    SegmentedVector() = default;
+    SegmentedVector(std::size_t n) : SegmentedVector() {
+        resize(n);
+    }
+    SegmentedVector(const SegmentedVector& other) : SegmentedVector() {
+        addChunks(other.m_size);
+        std::uninitialized_copy(other.begin(), other.end(), begin());
+        m_size = other.m_size;
+    }
+    SegmentedVector(SegmentedVector&& other) noexcept : SegmentedVector() {
+        swap(other);
+    }
+    SegmentedVector(std::initializer_list<T> ilist) : SegmentedVector() {
+        addChunks(ilist.size());
+        std::uninitialized_copy(ilist.begin(), ilist.end(), begin());
+        m_size = ilist.size();
+    }
+
+    virtual ~SegmentedVector() {
+        std::destroy(begin(), end());
+        removeChunks(0);
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& other) {
+        if (this != &other) {
+            SegmentedVector tmp { other };
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) noexcept {
+        if (this != &other) {
+            SegmentedVector tmp { std::move(other) };
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SegmentedVector& operator=(std::initializer_list<T> ilist) {
+        SegmentedVector tmp { ilist };
+        swap(tmp);
+        return *this;
+    }
+
+    T& operator[](std::size_t r) { return *address(r); }
+    const T& operator[](std::size_t r) const { return *address(r); }
+
+    void reserve(std::size_t n) {
+        addChunks(n);
+    }
+
+    // the chunks that hold no element are freed
+    void shrink_to_fit() {
+        removeChunks(m_size == 0 ? 0 : chunkOf(m_size - 1) + 1);
+    }
+
+    void resize(std::size_t n) {
+        if (n > m_size) {
+            addChunks(n);
+            std::uninitialized_value_construct(begin() + m_size, begin() + n);
+        } else {
+            std::destroy(begin() + n, end());
+        }
+        m_size = n;
+    }
+
+    void clear() override {
+        resize(0);
+    }
+
+    using LinearList<T, iterator, const_iterator>::insert;
+
+    iterator insert(iterator p, const T& e) override {
+        auto r { p.rank() };
+        addChunks(m_size + 1);
+        auto live { VectorShift::open(begin() + r, end(), 1) };
+        VectorShift::copy(begin() + r, end(), 1, live, &e);
+        ++m_size;
+        return begin() + r;
+    }
+
+    iterator insert(iterator p, T&& e) override {
+        auto r { p.rank() };
+        addChunks(m_size + 1);
+        auto live { VectorShift::open(begin() + r, end(), 1) };
+        VectorShift::copy(begin() + r, end(), 1, live, std::make_move_iterator(&e));
+        ++m_size;
+        return begin() + r;
+    }
+
+    // the chunks are added at once, then the tail is shifted by n, see VectorShift
+    iterator insert(iterator p, std::size_t n, const T& e) override {
+        auto r { p.rank() };
+        if (n == 0) {
+            return p;
+        }
+        T value { e }; // e may be an element of this vector
+        addChunks(m_size + n);
+        auto live { VectorShift::open(begin() + r, end(), n) };
+        VectorShift::fill(begin() + r, end(), n, live, value);
+        m_size += n;
+        return begin() + r;
+    }
+
+    // a forward (or sized) range is counted first, so the tail is shifted once and the new elements are copied
+    // into their slots, see VectorShift; other ranges are inserted one by one, see LinearList
+    template <std::input_iterator It, std::sentinel_for<It> End>
+    iterator insert(iterator p, It first, End last) {
+        if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<End, It>) {
+            auto r { p.rank() };
+            auto n { static_cast<std::size_t>(std::ranges::distance(first, last)) };
+            addChunks(m_size + n);
+            auto live { VectorShift::open(begin() + r, end(), n) };
+            VectorShift::copy(begin() + r, end(), n, live, first);
+            m_size += n;
+            return begin() + r;
+        } else {
+            return LinearList<T, iterator, const_iterator>::insert(p, first, last);
+        }
+    }
+
+    iterator insert(iterator p, std::initializer_list<T> ilist) {
+        return insert(p, ilist.begin(), ilist.end());
+    }
+
+    // these go through the insert above, the ones of LinearList would insert one by one
+    template <std::ranges::input_range R>
+    void append_range(R&& r) {
+        insert(end(), std::ranges::begin(r), std::ranges::end(r));
+    }
+
+    template <std::input_iterator It, std::sentinel_for<It> End>
+    void assign(It first, End last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    iterator find(const T& e) const override {
+        for (auto it { begin() }; it != end(); ++it) {
+            if (*it == e) {
+                return it;
+            }
+        }
+        return end();
+    }
+
+    iterator erase(iterator p) override {
+        return erase(p, p + 1);
+    }
+
+    iterator erase(iterator first, iterator last) override {
+        if (first == last) {
+            return first;
+        }
+        VectorShift::close(first, last, end());
+        m_size -= static_cast<std::size_t>(last - first);
+        return first;
+    }
+
+    // iterator-related methods below
+
+    iterator begin() noexcept override {
+        return iterator { this, 0 };
+    }
+
+    iterator end() noexcept override {
+        return iterator { this, m_size };
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator { this, 0 };
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator { this, m_size };
+    }
+
+    const_iterator cbegin() const noexcept override {
+        return const_iterator { this, 0 };
+    }
+
+    const_iterator cend() const noexcept override {
+        return const_iterator { this, m_size };
+    }
+
+    std::string type_name() const override {
+        return std::format("Segmented Vector [{} * 2^k]", FIRST);
+    }
+
+};
+
+}
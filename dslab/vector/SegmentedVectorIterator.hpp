@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../framework.hpp"
+#include <iterator>
+
+namespace dslab::vector {
+
+    // forward declaration of segmented vector iterator
+    template <typename V>
+    class SegmentedVectorIterator;
+
+    // const iterator for segmented vector
+    // the elements are not contiguous, so the iterator holds the vector and the rank,
+    // and finds the element through the chunk map of the vector (which takes O(1) time)
+    template <typename V>
+    class ConstSegmentedVectorIterator {
+    protected:
+        // vector to iterate
+        const V* m_vector { nullptr };
+
+        // rank of the current element
+        std::size_t m_rank { 0 };
+
+        friend class SegmentedVectorIterator<V>;
+
+    public:
+        using value_type = typename V::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr ConstSegmentedVectorIterator() = default;
+        constexpr ConstSegmentedVectorIterator(const V* vector, std::size_t rank) : m_vector(vector), m_rank(rank) {}
+
+        constexpr std::size_t rank() const { return m_rank; }
+
+        constexpr ConstSegmentedVectorIterator& operator++() { ++m_rank; return *this; }
+        constexpr ConstSegmentedVectorIterator operator++(int) { auto tmp { *this }; ++m_rank; return tmp; }
+        constexpr ConstSegmentedVectorIterator& operator--() { --m_rank; return *this; }
+        constexpr ConstSegmentedVectorIterator operator--(int) { auto tmp { *this }; --m_rank; return tmp; }
+
+        constexpr ConstSegmentedVectorIterator& operator+=(difference_type n) { m_rank += n; return *this; }
+        constexpr ConstSegmentedVectorIterator& operator-=(difference_type n) { m_rank -= n; return *this; }
+
+        constexpr friend ConstSegmentedVectorIterator operator+(difference_type n, const ConstSegmentedVectorIterator& it) { return it + n; }
+        constexpr ConstSegmentedVectorIterator operator+(difference_type n) const { return { m_vector, m_rank + n }; }
+        constexpr ConstSegmentedVectorIterator operator-(difference_type n) const { return { m_vector, m_rank - n }; }
+
+        constexpr difference_type operator-(const ConstSegmentedVectorIterator& rhs) const { return static_cast<difference_type>(m_rank - rhs.m_rank); }
+        constexpr reference operator*() const { return (*m_vector)[m_rank]; }
+        constexpr pointer operator->() const { return &(*m_vector)[m_rank]; }
+        constexpr reference operator[](difference_type n) const { return (*m_vector)[m_rank + n]; }
+        constexpr bool operator==(const ConstSegmentedVectorIterator& rhs) const { return m_rank == rhs.m_rank; }
+        constexpr auto operator<=>(const ConstSegmentedVectorIterator& rhs) const { return m_rank <=> rhs.m_rank; }
+    };
+
+    // iterator for segmented vector
+    template <typename V>
+    class SegmentedVectorIterator {
+    protected:
+        // vector to iterate
+        V* m_vector { nullptr };
+
+        // rank of the current element
+        std::size_t m_rank { 0 };
+
+    public:
+        using value_type = typename V::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr SegmentedVectorIterator() = default;
+        constexpr SegmentedVectorIterator(V* vector, std::size_t rank) : m_vector(vector), m_rank(rank) {}
+
+        // conversion from const iterator
+        constexpr SegmentedVectorIterator(const ConstSegmentedVectorIterator<V>& it) : m_vector(const_cast<V*>(it.m_vector)), m_rank(it.m_rank) {}
+
+        constexpr std::size_t rank() const { return m_rank; }
+
+        constexpr SegmentedVectorIterator& operator++() { ++m_rank; return *this; }
+        constexpr SegmentedVectorIterator operator++(int) { auto tmp { *this }; ++m_rank; return tmp; }
+        constexpr SegmentedVectorIterator& operator--() { --m_rank; return *this; }
+        constexpr SegmentedVectorIterator operator--(int) { auto tmp { *this }; --m_rank; return tmp; }
+
+        constexpr SegmentedVectorIterator& operator+=(difference_type n) { m_rank += n; return *this; }
+        constexpr SegmentedVectorIterator& operator-=(difference_type n) { m_rank -= n; return *this; }
+
+        constexpr friend SegmentedVectorIterator operator+(difference_type n, const SegmentedVectorIterator& it) { return it + n; }
+        constexpr SegmentedVectorIterator operator+(difference_type n) const { return { m_vector, m_rank + n }; }
+        constexpr SegmentedVectorIterator operator-(difference_type n) const { return { m_vector, m_rank - n }; }
+
+        constexpr difference_type operator-(const SegmentedVectorIterator& rhs) const { return static_cast<difference_type>(m_rank - rhs.m_rank); }
+        constexpr reference operator*() const { return (*m_vector)[m_rank]; }
+        constexpr pointer operator->() const { return &(*m_vector)[m_rank]; }
+        constexpr reference operator[](difference_type n) const { return (*m_vector)[m_rank + n]; }
+        constexpr bool operator==(const SegmentedVectorIterator& rhs) const { return m_rank == rhs.m_rank; }
+        constexpr auto operator<=>(const SegmentedVectorIterator& rhs) const { return m_rank <=> rhs.m_rank; }
+
+        // conversion to const iterator
+        constexpr operator ConstSegmentedVectorIterator<V>() const { return { m_vector, m_rank }; }
+    };
+
+}
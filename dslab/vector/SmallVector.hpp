@@ -0,0 +1,315 @@
+#pragma once
+
+#include "AbstractVector.hpp"
+#include "VectorAllocator.hpp"
+#include "VectorMemory.hpp"
+#include "VectorShift.hpp"
+
+namespace dslab::vector {
+
+// a vector that keeps up to N elements inside the object itself
+// small vectors never touch the heap; once the (N+1)-th element arrives, the elements spill to a heap block
+// that grows by the allocator policy like a Vector, and stays there until the vector is destroyed or moved from,
+// or until the size drops and the policy (or shrink_to_fit) gives the block back, the elements go inline again if they fit
+// the heap block comes from the resource the vector was created with, see VectorResource
+template <typename T, std::size_t N, typename A = VectorAllocatorGP<std::ratio<3, 2>>>
+    requires (N > 0) && std::is_base_of_v<VectorAllocator, A>
+class SmallVector : public AbstractVector<T> {
+protected:
+    // the inline storage, only the elements in [0, m_size) are constructed (if m_data points here)
+    union {
+        T m_inline[N];
+    };
+    T* m_data { m_inline };
+    std::size_t m_capacity { N };
+    std::size_t m_size { 0 };
+    A m_allocator {};
+    // where the heap block comes from, see VectorResource
+    std::pmr::memory_resource* m_resource { VectorResource::current() };
+
+    T* data() override { return m_data; }
+    const T* data() const override { return m_data; }
+
+    bool isInline() const { return m_data == m_inline; }
+
+    using Block = VectorBlock<T>;
+
+    static constexpr bool RELOCATABLE { Block::ALIGNED && is_trivially_relocatable_v<T> };
+
+    T* allocate(std::size_t n) const {
+        return Block::allocate(m_resource, n);
+    }
+    void deallocate(T* p, std::size_t n) const {
+        Block::deallocate(m_resource, p, n);
+    }
+
+    // destroy the elements and give the heap block back, the vector is empty and inline afterwards
+    void release() {
+        std::destroy_n(m_data, m_size);
+        if (!isInline()) {
+            deallocate(m_data, m_capacity);
+        }
+        m_data = m_inline;
+        m_capacity = N;
+        m_size = 0;
+    }
+
+    // take the heap block of other if it comes from the same resource, or move its elements one by one
+    // this vector must be empty and inline
+    void steal(SmallVector& other) {
+        if (other.isInline() || other.m_resource != m_resource) {
+            reserve(other.m_size);
+            std::uninitialized_move_n(other.m_data, other.m_size, m_data);
+            m_size = other.m_size;
+            other.release();
+        } else {
+            m_data = other.m_data;
+            m_capacity = other.m_capacity;
+            m_size = other.m_size;
+            other.m_data = other.m_inline;
+            other.m_capacity = N;
+            other.m_size = 0;
+        }
+    }
+
+    // replace the elements by the n elements from first, the vector keeps its resource
+    template <typename It>
+    void replace(It first, std::size_t n) {
+        SmallVector tmp {};
+        tmp.m_resource = m_resource;
+        tmp.reserve(n);
+        std::uninitialized_copy_n(first, n, tmp.m_data);
+        tmp.m_size = n;
+        release();
+        steal(tmp);
+    }
+
+    // move the elements to a heap block of capacity n (n >= m_size), or inline if n <= N
+    void relocate(std::size_t n) {
+        if constexpr (RELOCATABLE) {
+            if (!isInline() && n > N && m_resource == nullptr) {
+                m_data = static_cast<T*>(VectorMemory::reallocate(m_data, m_capacity * sizeof(T), Block::bytes(n)));
+                m_capacity = n;
+                return;
+            }
+        }
+        auto tmp { n > N ? allocate(n) : m_inline };
+        try {
+            std::uninitialized_move_n(m_data, m_size, tmp);
+        } catch (...) {
+            if (tmp != m_inline) {
+                deallocate(tmp, n);
+            }
+            throw;
+        }
+        std::destroy_n(m_data, m_size);
+        if (!isInline()) {
+            deallocate(m_data, m_capacity);
+        }
+        m_data = tmp;
+        m_capacity = std::max(n, N);
+    }
+
+    // called after the size drops, the allocator decides whether the heap block is too large, see Vector::shrink
+    void shrink() {
+        if (isInline() || m_size == m_capacity) {
+            return;
+        }
+        if (auto n { m_allocator(m_capacity, m_size) }; n < m_capacity) {
+            try {
+                relocate(std::max(n, m_size));
+            } catch (const std::bad_alloc&) {}
+        }
+    }
+
+public:
+    using allocator_type = A;
+
+    std::size_t capacity() const override { return m_capacity; }
+    std::size_t size() const override { return m_size; }
+
+    // the memory resource of the heap block, nullptr for VectorMemory
+    std::pmr::memory_resource* resource() const { return m_resource; }
+
+    // the union does not construct anything, so the constructors have to be written out
+    SmallVector() {}
+    SmallVector(std::size_t n) : SmallVector() {
+        reserve(n);
+        std::uninitialized_value_construct_n(m_data, n);
+        m_size = n;
+    }
+    // like any new vector, the copy takes its block from the current resource, not from other's
+    SmallVector(const SmallVector& other) : SmallVector() {
+        reserve(other.m_size);
+        std::uninitialized_copy_n(other.m_data, other.m_size, m_data);
+        m_size = other.m_size;
+    }
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : SmallVector() {
+        m_resource = other.m_resource;
+        steal(other);
+    }
+    SmallVector(std::initializer_list<T> ilist) : SmallVector() {
+        reserve(ilist.size());
+        std::uninitialized_copy(ilist.begin(), ilist.end(), m_data);
+        m_size = ilist.size();
+    }
+
+    virtual ~SmallVector() {
+        release();
+    }
+
+    // the vector keeps its own resource, as Vector does
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            replace(other.m_data, other.m_size);
+        }
+        return *this;
+    }
+
+    // the elements are moved one by one (and may throw) if other's heap block comes from another resource
+    SmallVector& operator=(SmallVector&& other) {
+        if (this != &other) {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> ilist) {
+        replace(ilist.begin(), ilist.size());
+        return *this;
+    }
+
+    void reserve(std::size_t n) override {
+        if (n > m_capacity) {
+            relocate(n);
+        }
+    }
+
+    // a heap block is cut down to the size, or given back if the elements fit inline again
+    void shrink_to_fit() override {
+        if (!isInline() && m_size < m_capacity) {
+            relocate(m_size);
+        }
+    }
+
+    void resize(std::size_t n) override {
+        if (n > m_size) {
+            if (n > m_capacity) {
+                reserve(n);
+            }
+            std::uninitialized_value_construct(m_data + m_size, m_data + n);
+            m_size = n;
+        } else {
+            std::destroy(m_data + n, m_data + m_size);
+            m_size = n;
+            shrink();
+        }
+    }
+
+    using iterator = AbstractVector<T>::iterator;
+    using const_iterator = AbstractVector<T>::const_iterator;
+    using AbstractVector<T>::begin;
+    using AbstractVector<T>::end;
+    using AbstractVector<T>::insert;
+
+    iterator insert(iterator p, const T& e) override {
+        auto r { static_cast<std::size_t>(p - begin()) };
+        if (m_size == m_capacity) {
+            reserve(m_allocator(m_capacity, m_size));
+        }
+        auto live { VectorShift::open(m_data + r, m_data + m_size, 1) };
+        VectorShift::copy(m_data + r, m_data + m_size, 1, live, &e);
+        ++m_size;
+        return begin() + r;
+    }
+
+    iterator insert(iterator p, T&& e) override {
+        auto r { static_cast<std::size_t>(p - begin()) };
+        if (m_size == m_capacity) {
+            reserve(m_allocator(m_capacity, m_size));
+        }
+        auto live { VectorShift::open(m_data + r, m_data + m_size, 1) };
+        VectorShift::copy(m_data + r, m_data + m_size, 1, live, std::make_move_iterator(&e));
+        ++m_size;
+        return begin() + r;
+    }
+
+    // one capacity check, then the tail is shifted by n at once, see VectorShift
+    iterator insert(iterator p, std::size_t n, const T& e) override {
+        auto r { static_cast<std::size_t>(p - begin()) };
+        if (n == 0) {
+            return p;
+        }
+        T value { e }; // e may be an element of this vector
+        if (m_size + n > m_capacity) {
+            reserve(std::max(m_allocator(m_capacity, m_size), m_size + n));
+        }
+        auto live { VectorShift::open(m_data + r, m_data + m_size, n) };
+        VectorShift::fill(m_data + r, m_data + m_size, n, live, value);
+        m_size += n;
+        return begin() + r;
+    }
+
+    // a forward (or sized) range is counted first, so the tail is shifted once and the new elements are copied
+    // into their slots, see VectorShift; other ranges are inserted one by one, see LinearList
+    template <std::input_iterator It, std::sentinel_for<It> End>
+    iterator insert(iterator p, It first, End last) {
+        if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<End, It>) {
+            auto r { static_cast<std::size_t>(p - begin()) };
+            auto n { static_cast<std::size_t>(std::ranges::distance(first, last)) };
+            if (m_size + n > m_capacity) {
+                reserve(std::max(m_allocator(m_capacity, m_size), m_size + n));
+            }
+            auto live { VectorShift::open(m_data + r, m_data + m_size, n) };
+            VectorShift::copy(m_data + r, m_data + m_size, n, live, first);
+            m_size += n;
+            return begin() + r;
+        } else {
+            return AbstractVector<T>::insert(p, first, last);
+        }
+    }
+
+    iterator insert(iterator p, std::initializer_list<T> ilist) {
+        return insert(p, ilist.begin(), ilist.end());
+    }
+
+    // these go through the insert above, the ones of LinearList would insert one by one
+    template <std::ranges::input_range R>
+    void append_range(R&& r) {
+        insert(end(), std::ranges::begin(r), std::ranges::end(r));
+    }
+
+    template <std::input_iterator It, std::sentinel_for<It> End>
+    void assign(It first, End last) {
+        this->clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    iterator erase(iterator p) override {
+        return erase(p, p + 1);
+    }
+
+    iterator erase(iterator first, iterator last) override {
+        if (first == last) {
+            return first;
+        }
+        auto n { static_cast<std::size_t>(last - first) };
+        auto r { static_cast<std::size_t>(first - begin()) };
+        VectorShift::close(m_data + r, m_data + r + n, m_data + m_size);
+        m_size -= n;
+        shrink();
+        return begin() + r;
+    }
+
+    std::string type_name() const override {
+        return std::format("Small Vector<{}> [{}]", N, m_allocator.type_name());
+    }
+
+};
+
+}
\ No newline at end of file
@@ -2,20 +2,147 @@
 
 #include "AbstractVector.hpp"
 #include "VectorAllocator.hpp"
+#include "VectorMemory.hpp"
+#include "VectorShift.hpp"
+#include "VectorStats.hpp"
 
 namespace dslab::vector {
 
-template <typename T, typename A = VectorAllocatorGP<std::ratio<3, 2>>>
+// A decides the capacity when the vector grows or shrinks, M provides the blocks (see VectorMemory),
+// and S counts the reallocations (see VectorStats)
+template <typename T, typename A = VectorAllocatorGP<std::ratio<3, 2>>, typename M = VectorMemory, typename S = VectorNoStats>
     requires std::is_base_of_v<VectorAllocator, A>
 class Vector : public AbstractVector<T> {
 protected:
-    std::unique_ptr<T[]> m_data { nullptr };
+    // only the elements in [0, m_size) are constructed, the rest of the block is raw storage
+    T* m_data { nullptr };
     std::size_t m_capacity { 0 };
     std::size_t m_size { 0 };
     A m_allocator {};
+    DSLAB_NO_UNIQUE_ADDRESS S m_stats {};
+    // where the block comes from, see VectorResource
+    std::pmr::memory_resource* m_resource { VectorResource::current() };
 
-    T* data() override { return m_data.get(); }
-    const T* data() const override { return m_data.get(); }
+    T* data() override { return m_data; }
+    const T* data() const override { return m_data; }
+
+    using Block = VectorBlock<T, M>;
+
+    // over-aligned types cannot live in malloc blocks, see VectorBlock
+    static constexpr bool ALIGNED { Block::ALIGNED };
+
+    // trivially relocatable elements are moved by resizing the block itself
+    static constexpr bool RELOCATABLE { ALIGNED && is_trivially_relocatable_v<T> };
+
+    // scalars are value-initialized to all-zero bytes, so they need not be written on memory that reads as zero
+    static constexpr bool ZERO_FILLED { ALIGNED && M::ZEROED && std::is_scalar_v<T> && !std::is_member_pointer_v<T> };
+
+    T* allocate(std::size_t n) const {
+        return Block::allocate(m_resource, n);
+    }
+    void deallocate(T* p, std::size_t n) const {
+        Block::deallocate(m_resource, p, n);
+    }
+
+    // replace the elements by the n elements from first (copied or moved), in a new block from m_resource
+    // the old elements are kept if a new one throws
+    template <typename It>
+    void replace(It first, std::size_t n) {
+        auto tmp { allocate(n) };
+        try {
+            std::uninitialized_copy_n(first, n, tmp);
+        } catch (...) {
+            deallocate(tmp, n);
+            throw;
+        }
+        m_allocator.finish(m_size);
+        std::destroy_n(m_data, m_size);
+        deallocate(m_data, m_capacity);
+        m_data = tmp;
+        m_capacity = n;
+        m_size = n;
+    }
+
+    // move the elements to a block of capacity n (n >= m_size), and return whether M resized the block itself
+    // a memory resource cannot resize a block in place, so its blocks are always moved element by element
+    bool transfer(std::size_t n) {
+        if constexpr (RELOCATABLE) {
+            if (m_resource == nullptr) {
+                m_data = static_cast<T*>(M::reallocate(m_data, m_capacity * sizeof(T), Block::bytes(n)));
+                m_capacity = n;
+                return true;
+            }
+        }
+        auto tmp { allocate(n) };
+        try {
+            std::uninitialized_move_n(m_data, m_size, tmp);
+        } catch (...) {
+            deallocate(tmp, n);
+            throw;
+        }
+        std::destroy_n(m_data, m_size);
+        deallocate(m_data, m_capacity);
+        m_data = tmp;
+        m_capacity = n;
+        return false;
+    }
+
+    // transfer, and count it in the stats if S has them
+    void reallocate(std::size_t n) {
+        if constexpr (S::ENABLED) {
+            auto start { std::chrono::steady_clock::now() };
+            if (transfer(n)) {
+                m_stats.m_copiedBytes += m_size * sizeof(T);
+            } else {
+                m_stats.m_movedElements += m_size;
+            }
+            ++m_stats.m_reallocations;
+            m_stats.m_peakCapacity = std::max(m_stats.m_peakCapacity, m_capacity);
+            m_stats.m_reserveTime += std::chrono::steady_clock::now() - start;
+        } else {
+            transfer(n);
+        }
+    }
+
+    // value-construct the elements in [m_size, n), the capacity must be at least n
+    // if M keeps the storage beyond m_size zeroed, scalars are already there and the pages are only faulted in
+    void extend(std::size_t n) {
+        if constexpr (ALIGNED) {
+            if (m_resource == nullptr) {
+                M::prefault(m_data + m_size, (n - m_size) * sizeof(T));
+                if constexpr (ZERO_FILLED) {
+                    m_size = n;
+                    return;
+                }
+            }
+        }
+        std::uninitialized_value_construct(m_data + m_size, m_data + n);
+        m_size = n;
+    }
+
+    // the elements in [n, m_size) have been destroyed, their storage is given back to M and then the block may shrink
+    void truncate(std::size_t n) {
+        if constexpr (ALIGNED) {
+            if (m_resource == nullptr) {
+                M::release(m_data + n, (m_size - n) * sizeof(T));
+            }
+        }
+        m_size = n;
+        shrink();
+    }
+
+    // called after the size drops, the allocator decides whether the block is too large
+    // shrinking is only an optimization, so the old block is kept if a new one cannot be obtained
+    void shrink() {
+        if (m_size == m_capacity) {
+            return;
+        }
+        if (auto n { m_allocator(m_capacity, m_size) }; n < m_capacity) {
+            try {
+                reallocate(std::max(n, m_size));
+            } catch (const std::bad_alloc&) {}
+        }
+    }
 
 public:
     using allocator_type = A;
@@ -23,102 +150,199 @@ public:
     std::size_t capacity() const override { return m_capacity; }
     std::size_t size() const override { return m_size; }
 
+    // the memory resource of the vector, nullptr for VectorMemory
+    std::pmr::memory_resource* resource() const { return m_resource; }
+
+    const S& stats() const { return m_stats; }
+
     Vector() = default;
-    Vector(std::size_t n) : m_data { std::make_unique<T[]>(n) }, m_capacity { n }, m_size { n } {}
-    Vector(const Vector& other) : Vector(other.m_size) { std::copy_n(other.m_data.get(), other.m_size, m_data.get()); }
-    Vector(Vector&& other) noexcept : m_data { std::move(other.m_data) }, m_capacity { other.m_capacity }, m_size { other.m_size } {
+    Vector(std::size_t n) : Vector() {
+        reserve(n);
+        extend(n);
+    }
+    // like any new vector, the copy takes its block from the current resource (see VectorResource), not from other's
+    Vector(const Vector& other) : Vector() {
+        reserve(other.m_size);
+        std::uninitialized_copy_n(other.m_data, other.m_size, m_data);
+        m_size = other.m_size;
+    }
+    Vector(Vector&& other) noexcept : m_data { other.m_data }, m_capacity { other.m_capacity }, m_size { other.m_size },
+        m_resource { other.m_resource } {
+        other.m_data = nullptr;
         other.m_capacity = 0;
         other.m_size = 0;
     }
-    Vector(std::initializer_list<T> ilist) : Vector(ilist.size()) {
-        std::move(ilist.begin(), ilist.end(), m_data.get());
+    Vector(std::initializer_list<T> ilist) : Vector() {
+        reserve(ilist.size());
+        std::uninitialized_copy(ilist.begin(), ilist.end(), m_data);
+        m_size = ilist.size();
     }
 
-    virtual ~Vector() = default;
+    virtual ~Vector() {
+        m_allocator.finish(m_size);
+        std::destroy_n(m_data, m_size);
+        deallocate(m_data, m_capacity);
+    }
 
+    // the block always comes from this vector's own resource, whatever the resource of other or the current one
     Vector& operator=(const Vector& other) {
         if (this != &other) {
-            Vector tmp { other };
-            std::swap(m_data, tmp.m_data);
-            std::swap(m_capacity, tmp.m_capacity);
-            std::swap(m_size, tmp.m_size);
+            replace(other.m_data, other.m_size);
         }
         return *this;
     }
 
-    Vector& operator=(Vector&& other) noexcept {
-        if (this != &other) {
-            m_data = std::move(other.m_data);
-            m_capacity = other.m_capacity;
-            m_size = other.m_size;
-            other.m_capacity = 0;
-            other.m_size = 0;
+    // the block of other is taken only if it comes from the same resource, otherwise the elements are moved one by one
+    Vector& operator=(Vector&& other) {
+        if (this == &other) {
+            return *this;
+        }
+        if (m_resource != other.m_resource) {
+            replace(std::make_move_iterator(other.m_data), other.m_size);
+            other.clear();
+            return *this;
         }
+        m_allocator.finish(m_size);
+        std::destroy_n(m_data, m_size);
+        deallocate(m_data, m_capacity);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_capacity = std::exchange(other.m_capacity, 0);
+        m_size = std::exchange(other.m_size, 0);
         return *this;
     }
 
     Vector& operator=(std::initializer_list<T> ilist) {
-        Vector tmp { ilist };
-        std::swap(m_data, tmp.m_data);
-        std::swap(m_capacity, tmp.m_capacity);
-        std::swap(m_size, tmp.m_size);
+        replace(ilist.begin(), ilist.size());
         return *this;
     }
 
     void reserve(std::size_t n) override {
         if (n > m_capacity) {
-            auto tmp { std::make_unique<T[]>(n) };
-            std::move(m_data.get(), m_data.get() + m_size, tmp.get());
-            m_data = std::move(tmp);
-            m_capacity = n;
+            reallocate(n);
+        }
+    }
+
+    // release all the spare capacity
+    void shrink_to_fit() override {
+        if (m_size < m_capacity) {
+            reallocate(m_size);
         }
     }
 
     void resize(std::size_t n) override {
-        if (n > m_capacity) {
-            reserve(n);
+        if (n > m_size) {
+            if (n > m_capacity) {
+                reserve(n);
+            }
+            extend(n);
+        } else {
+            if (n == 0) {
+                m_allocator.finish(m_size);
+            }
+            std::destroy(m_data + n, m_data + m_size);
+            truncate(n);
         }
-        m_size = n;
     }
 
     using iterator = AbstractVector<T>::iterator;
     using const_iterator = AbstractVector<T>::const_iterator;
     using AbstractVector<T>::begin;
     using AbstractVector<T>::end;
+    using AbstractVector<T>::insert;
 
     iterator insert(iterator p, const T& e) override {
+        auto r { static_cast<std::size_t>(p - begin()) };
         if (m_size == m_capacity) {
             reserve(m_allocator(m_capacity, m_size));
         }
-        std::move_backward(p, end(), end() + 1);
-        *p = e;
+        auto live { VectorShift::open(m_data + r, m_data + m_size, 1) };
+        VectorShift::copy(m_data + r, m_data + m_size, 1, live, &e);
         ++m_size;
-        return p;
+        return begin() + r;
     }
 
     iterator insert(iterator p, T&& e) override {
+        auto r { static_cast<std::size_t>(p - begin()) };
         if (m_size == m_capacity) {
             reserve(m_allocator(m_capacity, m_size));
         }
-        std::move_backward(p, end(), end() + 1);
-        *p = std::move(e);
+        auto live { VectorShift::open(m_data + r, m_data + m_size, 1) };
+        VectorShift::copy(m_data + r, m_data + m_size, 1, live, std::make_move_iterator(&e));
         ++m_size;
-        return p;
+        return begin() + r;
+    }
+
+    // one capacity check, then the tail is shifted by n at once, see VectorShift
+    iterator insert(iterator p, std::size_t n, const T& e) override {
+        auto r { static_cast<std::size_t>(p - begin()) };
+        if (n == 0) {
+            return p;
+        }
+        T value { e }; // e may be an element of this vector
+        if (m_size + n > m_capacity) {
+            reserve(std::max(m_allocator(m_capacity, m_size), m_size + n));
+        }
+        auto live { VectorShift::open(m_data + r, m_data + m_size, n) };
+        VectorShift::fill(m_data + r, m_data + m_size, n, live, value);
+        m_size += n;
+        return begin() + r;
     }
 
-    iterator find(const T& e) const override {
-        for (auto it { begin() }; it != end(); ++it) {
-            if (*it == e) {
-                return it;
+    // a forward (or sized) range is counted first, so the tail is shifted once and the new elements are copied
+    // into their slots, see VectorShift; other ranges are inserted one by one, see LinearList
+    template <std::input_iterator It, std::sentinel_for<It> End>
+    iterator insert(iterator p, It first, End last) {
+        if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<End, It>) {
+            auto r { static_cast<std::size_t>(p - begin()) };
+            auto n { static_cast<std::size_t>(std::ranges::distance(first, last)) };
+            if (m_size + n > m_capacity) {
+                reserve(std::max(m_allocator(m_capacity, m_size), m_size + n));
             }
+            auto live { VectorShift::open(m_data + r, m_data + m_size, n) };
+            VectorShift::copy(m_data + r, m_data + m_size, n, live, first);
+            m_size += n;
+            return begin() + r;
+        } else {
+            return AbstractVector<T>::insert(p, first, last);
         }
-        return end();
+    }
+
+    iterator insert(iterator p, std::initializer_list<T> ilist) {
+        return insert(p, ilist.begin(), ilist.end());
+    }
+
+    // these go through the insert above, the ones of LinearList would insert one by one
+    template <std::ranges::input_range R>
+    void append_range(R&& r) {
+        insert(end(), std::ranges::begin(r), std::ranges::end(r));
+    }
+
+    template <std::input_iterator It, std::sentinel_for<It> End>
+    void assign(It first, End last) {
+        this->clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> ilist) {
+        assign(ilist.begin(), ilist.end());
     }
 
     iterator erase(iterator p) override {
-        std::move(p + 1, end(), p);
-        --m_size;
-        return p;
+        auto r { static_cast<std::size_t>(p - begin()) };
+        VectorShift::close(m_data + r, m_data + r + 1, m_data + m_size);
+        truncate(m_size - 1);
+        return begin() + r;
+    }
+
+    iterator erase(iterator first, iterator last) override {
+        if (first == last) {
+            return first;
+        }
+        auto n { static_cast<std::size_t>(last - first) };
+        auto r { static_cast<std::size_t>(first - begin()) };
+        VectorShift::close(m_data + r, m_data + r + n, m_data + m_size);
+        truncate(m_size - n);
+        return begin() + r;
     }
 
     std::string type_name() const override {
@@ -1,13 +1,19 @@
 #pragma once
 
 #include "../framework.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
 
 namespace dslab::vector {
 
+// the vector calls the allocator when it is full (to get a larger capacity)
+// and after its size drops (to get a smaller capacity, or the same one to keep the block)
 class VectorAllocator : public Algorithm<std::size_t(std::size_t, std::size_t)> {
 protected:
     virtual std::size_t expand(std::size_t capacity, std::size_t size) const = 0;
-    virtual std::size_t shrink(std::size_t capacity, std::size_t size) const {
+    // by default, the vector never gives memory back
+    virtual std::size_t shrink(std::size_t capacity, std::size_t) const {
         return capacity;
     }
 public:
@@ -18,6 +24,10 @@ public:
             return shrink(capacity, size);
         }
     }
+
+    // the vector reports its size when it lets go of all its elements (clear or destruction)
+    // a policy may learn the final sizes from it, by default it is ignored
+    virtual void finish(std::size_t) {}
 };
 
 template <std::size_t D> requires (D > 0)
@@ -49,4 +59,104 @@ public:
     }
 };
 
+// the shrinking versions of the policies above
+// a block shrinks only when it is much emptier than right after an expansion,
+// so that alternating pushes and pops around a boundary never reallocate every time
+// note that with these policies, erase and resize may move the elements and invalidate iterators
+
+// shrink by D while at least 2D slots are free, so that D to 2D slots are left free
+template <std::size_t D> requires (D > 0)
+class VectorAllocatorAPShrink : public VectorAllocatorAP<D> {
+protected:
+    std::size_t shrink(std::size_t capacity, std::size_t size) const override {
+        if (capacity - size < 2 * D) {
+            return capacity;
+        }
+        return capacity - ((capacity - size) / D - 1) * D;
+    }
+public:
+    std::string type_name() const override {
+        return std::format("C -> C + {} (shrink)", D);
+    }
+};
+
+// divide by Q while the occupancy is at most 1/Q^2, so that the block is at most 1/Q full afterwards
+// e.g. for Q = 2, the block is halved when it is a quarter full
+template <typename Q> requires (Q::num > Q::den)
+class VectorAllocatorGPShrink : public VectorAllocatorGP<Q> {
+protected:
+    std::size_t shrink(std::size_t capacity, std::size_t size) const override {
+        while (capacity > 0 && size * Q::num * Q::num <= capacity * Q::den * Q::den) {
+            capacity = capacity * Q::den / Q::num;
+        }
+        return capacity;
+    }
+public:
+    std::string type_name() const override {
+        return VectorAllocatorGP<Q>::type_name() + " (shrink)";
+    }
+};
+
+// a policy that adapts to the history of the vectors using it
+// - the final sizes (see VectorAllocator::finish) of the vectors with the same Tag are kept per thread;
+//   when the last HISTORY of them agree within 1/8, a vector jumps straight to the largest of them
+// - otherwise, the growth follows the rate of insertion since the last expansion: the new capacity holds
+//   the elements expected within HORIZON at that rate, but at least 1/8 and at most all of the size more,
+//   so a burst doubles the capacity while a slow trickle over-allocates by 1/8 only
+// the growth is still geometric, so push_back still takes amortized O(1) time
+template <typename Tag = void>
+class VectorAllocatorAdaptive : public VectorAllocator {
+public:
+    static constexpr std::size_t HISTORY { 4 };
+    static constexpr std::chrono::duration<double> HORIZON { std::chrono::milliseconds { 50 } };
+
+protected:
+    static thread_local inline std::array<std::size_t, HISTORY> s_finals {};
+    static thread_local inline std::size_t s_finished { 0 };
+
+    // the time and the size of the last expansion of this vector
+    mutable std::chrono::steady_clock::time_point m_last {};
+    mutable std::size_t m_lastSize { 0 };
+
+    // the expected final size, or 0 if the history does not agree
+    static std::size_t predict() {
+        if (s_finished < HISTORY) {
+            return 0;
+        }
+        auto [low, high] { std::ranges::minmax(s_finals) };
+        return high - low <= low / 8 ? high : 0;
+    }
+
+    std::size_t expand(std::size_t capacity, std::size_t size) const override {
+        auto now { std::chrono::steady_clock::now() };
+        auto elapsed { now - m_last };
+        auto inserted { size - std::min(size, m_lastSize) };
+        auto first { m_last == std::chrono::steady_clock::time_point {} };
+        m_last = now;
+        m_lastSize = size;
+        if (auto prediction { predict() }; prediction > size) {
+            return prediction;
+        }
+        auto low { std::max(size / 8, 1uz) }, high { std::max(size, 1uz) };
+        if (first || elapsed <= elapsed.zero()) {
+            return capacity + high;
+        }
+        auto expected { inserted * (HORIZON / elapsed) };
+        return capacity + static_cast<std::size_t>(std::clamp(expected, static_cast<double>(low), static_cast<double>(high)));
+    }
+
+public:
+    void finish(std::size_t size) override {
+        if (size > 0) {
+            s_finals[s_finished++ % HISTORY] = size;
+        }
+        m_last = {};
+        m_lastSize = 0;
+    }
+
+    std::string type_name() const override {
+        return "C -> adaptive";
+    }
+};
+
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "AbstractVector.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace dslab::vector {
+
+// the binary file format of a vector of trivially copyable elements
+// - a header of HEADER_SIZE bytes, see VectorFileHeader
+// - then the elements, exactly as they are in memory, starting at offset HEADER_SIZE
+//   (a multiple of the alignment of every element type it accepts, so a mapped file can be used in place)
+// - a file may hold more slots than elements (the capacity), the bytes after the elements are unspecified
+// the file is only readable on a machine with the same byte order and the same layout of T
+struct VectorFileHeader {
+    char m_magic[8];
+    std::uint32_t m_version;
+    std::uint32_t m_headerSize;
+    // written as 1, so a file of the other byte order reads it as 1 << 24
+    std::uint32_t m_byteOrder;
+    std::uint32_t m_reserved;
+    std::uint64_t m_elementSize;
+    std::uint64_t m_elementAlign;
+    // the number of elements, and the number of slots in the file
+    std::uint64_t m_size;
+    std::uint64_t m_capacity;
+};
+
+class VectorFile {
+public:
+    static constexpr char MAGIC[8] { 'D', 'S', 'L', 'A', 'B', 'V', 'E', 'C' };
+    static constexpr std::uint32_t VERSION { 1 };
+    static constexpr std::size_t HEADER_SIZE { 64 };
+    static_assert(sizeof(VectorFileHeader) <= HEADER_SIZE);
+
+    template <typename T>
+    static constexpr bool supports { std::is_trivially_copyable_v<T> && HEADER_SIZE % alignof(T) == 0 };
+
+    template <typename T> requires supports<T>
+    static VectorFileHeader header(std::size_t size, std::size_t capacity) {
+        VectorFileHeader h {};
+        std::memcpy(h.m_magic, MAGIC, sizeof(MAGIC));
+        h.m_version = VERSION;
+        h.m_headerSize = HEADER_SIZE;
+        h.m_byteOrder = 1;
+        h.m_elementSize = sizeof(T);
+        h.m_elementAlign = alignof(T);
+        h.m_size = size;
+        h.m_capacity = capacity;
+        return h;
+    }
+
+    // throw if the file of this header does not hold elements of type T
+    // fileSize is the length of the whole file, which must cover the capacity
+    template <typename T> requires supports<T>
+    static void check(const VectorFileHeader& h, std::size_t fileSize) {
+        if (fileSize < HEADER_SIZE || std::memcmp(h.m_magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("not a vector file");
+        }
+        if (h.m_version != VERSION || h.m_headerSize != HEADER_SIZE) {
+            throw std::runtime_error(std::format("unsupported vector file version {}", h.m_version));
+        }
+        if (h.m_byteOrder != 1) {
+            throw std::runtime_error("vector file of the other byte order");
+        }
+        if (h.m_elementSize != sizeof(T) || h.m_elementAlign != alignof(T)) {
+            throw std::runtime_error(std::format("vector file of {}-byte elements, expected {}", h.m_elementSize, sizeof(T)));
+        }
+        if (h.m_size > h.m_capacity || h.m_capacity > (fileSize - HEADER_SIZE) / sizeof(T)) {
+            throw std::runtime_error("truncated vector file");
+        }
+    }
+
+    // write the elements in [data, data + n) to a new file
+    template <typename T> requires supports<T>
+    static void save(const std::string& path, const T* data, std::size_t n) {
+        std::ofstream out { path, std::ios::binary | std::ios::trunc };
+        auto h { header<T>(n, n) };
+        char head[HEADER_SIZE] {};
+        std::memcpy(head, &h, sizeof(h));
+        out.write(head, HEADER_SIZE);
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n * sizeof(T)));
+        if (!out.flush()) {
+            throw std::runtime_error(std::format("cannot write vector file {}", path));
+        }
+    }
+
+    template <typename T> requires supports<T>
+    static void save(const std::string& path, const AbstractVector<T>& V) {
+        save(path, V.size() == 0 ? nullptr : &V[0], V.size());
+    }
+
+    // read the whole file into a vector (a copy, see MappedVector to use the file in place)
+    // the elements are read in one piece, so the vector must be contiguous
+    template <typename V, typename T = typename V::value_type> requires supports<T> && std::is_base_of_v<AbstractVector<T>, V>
+    static void load(const std::string& path, V& v) {
+        std::ifstream in { path, std::ios::binary | std::ios::ate };
+        if (!in) {
+            throw std::runtime_error(std::format("cannot open vector file {}", path));
+        }
+        auto fileSize { static_cast<std::size_t>(in.tellg()) };
+        VectorFileHeader h {};
+        if (fileSize < HEADER_SIZE || !in.seekg(0).read(reinterpret_cast<char*>(&h), sizeof(h))) {
+            throw std::runtime_error("not a vector file");
+        }
+        check<T>(h, fileSize);
+        v.resize(h.m_size);
+        if (h.m_size > 0 && !in.seekg(HEADER_SIZE).read(reinterpret_cast<char*>(&v[0]), static_cast<std::streamsize>(h.m_size * sizeof(T)))) {
+            throw std::runtime_error(std::format("cannot read vector file {}", path));
+        }
+    }
+};
+
+}
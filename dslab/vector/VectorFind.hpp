@@ -0,0 +1,181 @@
+#pragma once
+
+#include "../framework.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DSLAB_VECTOR_FIND_SIMD
+#include <immintrin.h>
+#endif
+
+namespace dslab::vector {
+
+// linear search over contiguous arithmetic elements
+// the elements are compared a whole register at a time (AVX2 if the CPU has it, SSE2 otherwise),
+// and a large range is split among several threads, which stop as soon as an earlier match is known
+// the result is the same as the scalar loop: the first element that is == e (so NaN is never found, and -0.0 == 0.0)
+class VectorFind {
+public:
+    // ranges of at least this many bytes are searched in parallel
+    static constexpr std::size_t PARALLEL_THRESHOLD { 1uz << 24 };
+
+    // each thread checks whether it can stop after this many bytes
+    static constexpr std::size_t BLOCK { 1uz << 16 };
+
+    template <typename T>
+    static constexpr bool supports {
+        std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+    };
+
+    template <typename T> requires supports<T>
+    static const T* find(const T* first, const T* last, const T& e) {
+        auto n { static_cast<std::size_t>(last - first) };
+        auto threads { std::min<std::size_t>(std::thread::hardware_concurrency(), n * sizeof(T) / PARALLEL_THRESHOLD) };
+        if (threads <= 1) {
+            return sequential(first, last, e);
+        }
+        // the rank of the first match found so far, every thread skips the blocks after it
+        std::atomic<std::size_t> found { n };
+        auto search { [&](std::size_t k) {
+            constexpr auto step { BLOCK / sizeof(T) };
+            for (auto lo { n * k / threads }, hi { n * (k + 1) / threads }; lo < hi; lo += step) {
+                if (found.load(std::memory_order_relaxed) < lo) {
+                    return;
+                }
+                auto end { first + std::min(lo + step, hi) };
+                if (auto p { sequential(first + lo, end, e) }; p != end) {
+                    auto r { static_cast<std::size_t>(p - first) };
+                    auto current { found.load(std::memory_order_relaxed) };
+                    while (r < current && !found.compare_exchange_weak(current, r, std::memory_order_relaxed)) {}
+                    return;
+                }
+            }
+        } };
+        {
+            std::vector<std::jthread> workers {};
+            for (auto k { 1uz }; k < threads; ++k) {
+                workers.emplace_back(search, k);
+            }
+            search(0);
+        }
+        return first + found.load();
+    }
+
+    template <typename T> requires supports<T>
+    static const T* sequential(const T* first, const T* last, const T& e) {
+#ifdef DSLAB_VECTOR_FIND_SIMD
+        static const bool avx2 { __builtin_cpu_supports("avx2") != 0 };
+        if (avx2) {
+            return findAVX2(first, last, e);
+        }
+        return findSSE2(first, last, e);
+#else
+        return findScalar(first, last, e);
+#endif
+    }
+
+private:
+    template <typename T>
+    static const T* findScalar(const T* first, const T* last, const T& e) {
+        while (first != last && !(*first == e)) {
+            ++first;
+        }
+        return first;
+    }
+
+#ifdef DSLAB_VECTOR_FIND_SIMD
+    // compare the lanes of a and b, and set all the bytes of the equal lanes
+    template <typename T>
+    [[gnu::target("sse2")]] static __m128i equal(__m128i a, __m128i b) {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_cmpeq_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpeq_epi16(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_cmpeq_epi32(a, b);
+        } else {
+            // SSE2 has no 64-bit compare, a 64-bit lane is equal if both of its halves are
+            auto c { _mm_cmpeq_epi32(a, b) };
+            return _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+    template <typename T>
+    [[gnu::target("avx2")]] static __m256i equal(__m256i a, __m256i b) {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpeq_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpeq_epi16(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_cmpeq_epi32(a, b);
+        } else {
+            return _mm256_cmpeq_epi64(a, b);
+        }
+    }
+
+    [[gnu::target("sse2")]] static __m128i load128(const void* p) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    [[gnu::target("avx2")]] static __m256i load256(const void* p) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+
+    // 4 registers per round, the byte mask of the first equal lane gives the position
+    template <typename T>
+    [[gnu::target("sse2")]] static const T* findSSE2(const T* first, const T* last, const T& e) {
+        constexpr std::size_t W { 16 / sizeof(T) };
+        T lanes[W];
+        std::fill_n(lanes, W, e);
+        auto key { load128(lanes) };
+        for (; static_cast<std::size_t>(last - first) >= 4 * W; first += 4 * W) {
+            auto c0 { equal<T>(load128(first), key) }, c1 { equal<T>(load128(first + W), key) };
+            auto c2 { equal<T>(load128(first + 2 * W), key) }, c3 { equal<T>(load128(first + 3 * W), key) };
+            if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3))) != 0) {
+                break;
+            }
+        }
+        for (; static_cast<std::size_t>(last - first) >= W; first += W) {
+            if (auto mask { _mm_movemask_epi8(equal<T>(load128(first), key)) }; mask != 0) {
+                return first + std::countr_zero(static_cast<unsigned>(mask)) / sizeof(T);
+            }
+        }
+        return findScalar(first, last, e);
+    }
+
+    template <typename T>
+    [[gnu::target("avx2")]] static const T* findAVX2(const T* first, const T* last, const T& e) {
+        constexpr std::size_t W { 32 / sizeof(T) };
+        T lanes[W];
+        std::fill_n(lanes, W, e);
+        auto key { load256(lanes) };
+        for (; static_cast<std::size_t>(last - first) >= 4 * W; first += 4 * W) {
+            auto c0 { equal<T>(load256(first), key) }, c1 { equal<T>(load256(first + W), key) };
+            auto c2 { equal<T>(load256(first + 2 * W), key) }, c3 { equal<T>(load256(first + 3 * W), key) };
+            if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3)), _mm256_set1_epi8(-1))) {
+                break;
+            }
+        }
+        for (; static_cast<std::size_t>(last - first) >= W; first += W) {
+            if (auto mask { _mm256_movemask_epi8(equal<T>(load256(first), key)) }; mask != 0) {
+                return first + std::countr_zero(static_cast<unsigned>(mask)) / sizeof(T);
+            }
+        }
+        return findScalar(first, last, e);
+    }
+#endif
+};
+
+}
@@ -1,15 +1,23 @@
 #pragma once
 
 #include "Vector.hpp"
+#include "SegmentedVector.hpp"
 
-template <typename T, template <typename> typename V>
-requires std::is_base_of_v<dslab::vector::AbstractVector<T>, V<T>>
-struct std::formatter<V<T>> {
+// any vector type, including the ones with non-default policies (e.g. a Vector with VectorStats)
+template <typename V>
+requires (std::is_base_of_v<dslab::vector::AbstractVector<typename V::value_type>, V> ||
+            std::is_base_of_v<dslab::vector::SegmentedVector<typename V::value_type>, V>)
+struct std::formatter<V> {
     // output format : [a1, a2, a3, ...]
+
+    // the vectors that count their reallocations, see VectorStats
+    static constexpr bool HAS_STATS { requires (const V& v) { v.stats().m_reallocations; } };
     
     std::size_t m_maxElements { 16uz }; // default value
     bool m_printSize { false };
     bool m_printCapacity { false };
+    bool m_printSlack { false };
+    bool m_printStats { false };
     
     constexpr auto parse(std::format_parse_context& ctx) {
         auto it { ctx.begin() }, end { ctx.end() };
@@ -18,6 +26,8 @@ struct std::formatter<V<T>> {
         // - 'E' : print all elements
         // - 's' : print the size of the vector
         // - 'c' : print the capacity of the vector
+        // - 'l' : print the slack of the vector (the capacity not holding elements)
+        // - 'r' : print the reallocation stats of the vector (only for vectors with VectorStats)
 
         while (it != end) {
             if (*it == 'e') {
@@ -34,6 +44,13 @@ struct std::formatter<V<T>> {
                 m_printSize = true;
             } else if (*it == 'c') {
                 m_printCapacity = true;
+            } else if (*it == 'l') {
+                m_printSlack = true;
+            } else if (*it == 'r') {
+                if (!HAS_STATS) {
+                    throw std::format_error("the vector has no stats");
+                }
+                m_printStats = true;
             } else if (*it == '}') {
                 break;
             }
@@ -44,7 +61,7 @@ struct std::formatter<V<T>> {
     }
 
     template <typename FormatContext>
-    auto format(const V<T>& v, FormatContext& ctx) const {
+    auto format(const V& v, FormatContext& ctx) const {
         std::string result { "[" };
         std::size_t count { 0 };
         for (auto it { std::begin(v) }; it != std::end(v) && count < m_maxElements; ++it) {
@@ -68,6 +85,16 @@ struct std::formatter<V<T>> {
                 result += std::format(" (m: {})", v.capacity());
             }
         }
+        if (m_printSlack) {
+            result += std::format(" (slack: {})", v.capacity() - v.size());
+        }
+        if constexpr (HAS_STATS) {
+            if (m_printStats) {
+                auto& stats { v.stats() };
+                result += std::format(" (reallocations: {}, moved: {}, copied: {} B, peak: {}, reserve: {} ns)",
+                    stats.m_reallocations, stats.m_movedElements, stats.m_copiedBytes, stats.m_peakCapacity, stats.m_reserveTime.count());
+            }
+        }
         return std::format_to(ctx.out(), "{}", result);
     }
 };
\ No newline at end of file
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "VectorMemory.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace dslab::vector {
+
+#ifdef __linux__
+
+// raw memory blocks for very large vectors, pass it as the M parameter of Vector
+// - every block is an anonymous mapping, which can be resized by mremap
+// - a block of at least one huge page is aligned to and rounded up to huge pages, and comes from the reserved
+//   huge pages (MAP_HUGETLB) if the system has any, or is marked for transparent huge pages otherwise
+// - fresh pages read as zero, so a vector of scalars does not write the zeros itself (lazy zero-fill),
+//   and released storage is cleared, mostly by giving the pages back to the system (MADV_DONTNEED)
+// - a large range is faulted in by several threads at once, instead of one page fault after another on first touch
+class VectorHugeMemory {
+public:
+    static constexpr std::size_t PAGE_SIZE { 1uz << 12 };
+    static constexpr std::size_t HUGE_PAGE_SIZE { 1uz << 21 };
+
+    // smaller ranges are faulted in lazily, and each prefaulting thread takes at least this much
+    static constexpr std::size_t PREFAULT_CHUNK { 1uz << 26 };
+
+    // MADV_POPULATE_WRITE (Linux 5.14), older kernels reject it and the pages are touched one by one
+    static constexpr int POPULATE_WRITE { 23 };
+
+    static constexpr bool ZEROED { true };
+
+    // the length of the mapping of a block
+    static std::size_t length(std::size_t bytes) {
+        auto unit { bytes >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE : PAGE_SIZE };
+        return (bytes + unit - 1) / unit * unit;
+    }
+
+    static void* allocate(std::size_t bytes) {
+        if (bytes == 0) {
+            return nullptr;
+        }
+        auto len { length(bytes) };
+        if (len < HUGE_PAGE_SIZE) {
+            return map(len);
+        }
+        if (auto p { mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0) }; p != MAP_FAILED) {
+            return p;
+        }
+        // map one more huge page and cut off both ends, so that the block starts at a huge page boundary
+        auto raw { static_cast<std::byte*>(map(len + HUGE_PAGE_SIZE)) };
+        auto head { (HUGE_PAGE_SIZE - reinterpret_cast<std::uintptr_t>(raw) % HUGE_PAGE_SIZE) % HUGE_PAGE_SIZE };
+        if (head > 0) {
+            munmap(raw, head);
+        }
+        munmap(raw + head + len, HUGE_PAGE_SIZE - head);
+        madvise(raw + head, len, MADV_HUGEPAGE);
+        return raw + head;
+    }
+
+    static void deallocate(void* p, std::size_t bytes) {
+        if (p != nullptr) {
+            munmap(p, length(bytes));
+        }
+    }
+
+    // mremap keeps the pages, a block that becomes huge is copied once to get the alignment
+    static void* reallocate(void* p, std::size_t oldBytes, std::size_t newBytes) {
+        if (p == nullptr) {
+            return allocate(newBytes);
+        }
+        if (newBytes == 0) {
+            deallocate(p, oldBytes);
+            return nullptr;
+        }
+        auto oldLength { length(oldBytes) }, newLength { length(newBytes) };
+        if (oldLength == newLength) {
+            return p;
+        }
+        if (oldLength >= HUGE_PAGE_SIZE || newLength < HUGE_PAGE_SIZE) {
+            if (auto q { mremap(p, oldLength, newLength, MREMAP_MAYMOVE) }; q != MAP_FAILED) {
+                return q;
+            }
+        }
+        auto q { allocate(newBytes) };
+        std::memcpy(q, p, std::min(oldBytes, newBytes));
+        deallocate(p, oldBytes);
+        return q;
+    }
+
+    // the content is kept, so the range may share its first and last pages with live elements
+    static void prefault(void* p, std::size_t bytes) {
+        if (bytes < PREFAULT_CHUNK) {
+            return;
+        }
+        auto first { reinterpret_cast<std::uintptr_t>(p) / PAGE_SIZE * PAGE_SIZE };
+        auto last { reinterpret_cast<std::uintptr_t>(p) + bytes };
+        auto pages { (last - first + PAGE_SIZE - 1) / PAGE_SIZE };
+        auto threads { std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, bytes / PREFAULT_CHUNK) };
+        auto populate { [=](std::size_t k) {
+            auto begin { first + pages * k / threads * PAGE_SIZE }, end { first + pages * (k + 1) / threads * PAGE_SIZE };
+            if (madvise(reinterpret_cast<void*>(begin), end - begin, POPULATE_WRITE) != 0) {
+                for (auto page { begin }; page < end; page += PAGE_SIZE) {
+                    auto q { reinterpret_cast<volatile char*>(page) };
+                    *q = *q;
+                }
+            }
+        } };
+        std::vector<std::jthread> workers {};
+        for (auto k { 1uz }; k < threads; ++k) {
+            workers.emplace_back(populate, k);
+        }
+        populate(0);
+    }
+
+    // the whole pages inside the range are given back, and the rest is cleared
+    static void release(void* p, std::size_t bytes) {
+        auto first { reinterpret_cast<std::uintptr_t>(p) }, last { first + bytes };
+        auto begin { (first + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE }, end { last / PAGE_SIZE * PAGE_SIZE };
+        if (begin >= end) {
+            std::memset(p, 0, bytes);
+            return;
+        }
+        std::memset(p, 0, begin - first);
+        std::memset(reinterpret_cast<void*>(end), 0, last - end);
+        // huge pages can only be given back as a whole, then the range is cleared by hand
+        if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED) != 0) {
+            std::memset(reinterpret_cast<void*>(begin), 0, end - begin);
+        }
+    }
+
+private:
+    static void* map(std::size_t len) {
+        auto p { mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc {};
+        }
+        return p;
+    }
+};
+
+#else
+
+// without mmap, the blocks come from VectorMemory as usual
+class VectorHugeMemory : public VectorMemory {};
+
+#endif
+
+}
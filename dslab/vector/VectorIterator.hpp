@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../framework.hpp"
+#include <iterator>
 
 namespace dslab::vector {
 
@@ -9,105 +10,105 @@ namespace dslab::vector {
     class VectorIterator;
 
     // const iterator for vector
+    // the elements of a vector are contiguous, so the iterator holds the address of the element directly;
+    // std algorithms can then treat it as a pointer (e.g. lower std::move to memmove, or vectorize loops)
     template <typename V>
     class ConstVectorIterator {
     protected:
-        // pointer to the vector
-        const V* m_vector { nullptr };
-
-        // current rank
-        std::size_t m_index { 0 };
+        // address of the current element
+        const typename V::value_type* m_pointer { nullptr };
 
         friend class VectorIterator<V>;
 
     public:
         using value_type = typename V::value_type;
+        using element_type = const value_type;
         using difference_type = std::ptrdiff_t;
         using pointer = const value_type*;
         using reference = const value_type&;
         using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::contiguous_iterator_tag;
 
         // default constructor
         constexpr ConstVectorIterator() = default;
 
-        // constructor with vector and rank
-        constexpr ConstVectorIterator(const V* vector, std::size_t index) : m_vector(vector), m_index(index) {}
-
-        constexpr ConstVectorIterator& operator++() { ++m_index; return *this; }
-        constexpr ConstVectorIterator operator++(int) { auto tmp { *this }; ++m_index; return tmp; }
-        constexpr ConstVectorIterator& operator--() { --m_index; return *this; }
-        constexpr ConstVectorIterator operator--(int) { auto tmp { *this }; --m_index; return tmp; }
-
-        constexpr ConstVectorIterator& operator+=(difference_type n) { m_index += n; return *this; }
-        constexpr ConstVectorIterator& operator-=(difference_type n) { return *this += (-n); }
-        
-        constexpr friend ConstVectorIterator operator+(difference_type n, const ConstVectorIterator& it) { return ConstVectorIterator { it.m_vector, it.m_index + n }; }
-        constexpr ConstVectorIterator operator+(difference_type n) const { return n + *this; }
-        constexpr ConstVectorIterator operator-(difference_type n) const { return *this + (-n); }
-
-        constexpr difference_type operator-(const ConstVectorIterator& rhs) const { return m_index - rhs.m_index; }
-        constexpr reference operator*() const { return m_vector->operator[](m_index); }
-        constexpr pointer operator->() const { return &m_vector->operator[](m_index); }
-        constexpr reference operator[](difference_type n) const { return m_vector->operator[](m_index + n); }
-        constexpr bool operator==(const ConstVectorIterator& rhs) const { return m_index == rhs.m_index; }
-        constexpr auto operator<=>(const ConstVectorIterator& rhs) const { return m_index <=> rhs.m_index; }
+        // constructor with the address of the element
+        constexpr explicit ConstVectorIterator(pointer p) : m_pointer(p) {}
+
+        constexpr ConstVectorIterator& operator++() { ++m_pointer; return *this; }
+        constexpr ConstVectorIterator operator++(int) { auto tmp { *this }; ++m_pointer; return tmp; }
+        constexpr ConstVectorIterator& operator--() { --m_pointer; return *this; }
+        constexpr ConstVectorIterator operator--(int) { auto tmp { *this }; --m_pointer; return tmp; }
+
+        constexpr ConstVectorIterator& operator+=(difference_type n) { m_pointer += n; return *this; }
+        constexpr ConstVectorIterator& operator-=(difference_type n) { m_pointer -= n; return *this; }
+
+        constexpr friend ConstVectorIterator operator+(difference_type n, const ConstVectorIterator& it) { return ConstVectorIterator { it.m_pointer + n }; }
+        constexpr ConstVectorIterator operator+(difference_type n) const { return ConstVectorIterator { m_pointer + n }; }
+        constexpr ConstVectorIterator operator-(difference_type n) const { return ConstVectorIterator { m_pointer - n }; }
+
+        constexpr difference_type operator-(const ConstVectorIterator& rhs) const { return m_pointer - rhs.m_pointer; }
+        constexpr reference operator*() const { return *m_pointer; }
+        constexpr pointer operator->() const { return m_pointer; }
+        constexpr reference operator[](difference_type n) const { return m_pointer[n]; }
+        constexpr bool operator==(const ConstVectorIterator& rhs) const { return m_pointer == rhs.m_pointer; }
+        constexpr auto operator<=>(const ConstVectorIterator& rhs) const { return m_pointer <=> rhs.m_pointer; }
     };
 
     // iterator for vector
     template <typename V>
     class VectorIterator {
     protected:
-        // pointer to the vector
-        V* m_vector { nullptr };
+        // address of the current element
+        typename V::value_type* m_pointer { nullptr };
 
-        // current rank
-        std::size_t m_index { 0 };
-    
     public:
         using value_type = typename V::value_type;
+        using element_type = value_type;
         using difference_type = std::ptrdiff_t;
         using pointer = value_type*;
         using reference = value_type&;
         using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::contiguous_iterator_tag;
 
         // default constructor
         constexpr VectorIterator() = default;
 
-        // constructor with vector and rank
-        constexpr VectorIterator(V* vector, std::size_t index) : m_vector(vector), m_index(index) {}
+        // constructor with the address of the element
+        constexpr explicit VectorIterator(pointer p) : m_pointer(p) {}
 
         // conversion from const iterator
-        constexpr VectorIterator(const ConstVectorIterator<V>& it) : m_vector(const_cast<V*>(it.m_vector)), m_index(it.m_index) {}
-
-        constexpr VectorIterator& operator++() { ++m_index; return *this; }
-        constexpr VectorIterator operator++(int) { auto tmp { *this }; ++m_index; return tmp; }
-        constexpr VectorIterator& operator--() { --m_index; return *this; }
-        constexpr VectorIterator operator--(int) { auto tmp { *this }; --m_index; return tmp; }
-
-        constexpr VectorIterator& operator+=(difference_type n) { m_index += n; return *this; }
-        constexpr VectorIterator& operator-=(difference_type n) { return *this += (-n); }
-
-        constexpr friend VectorIterator operator+(difference_type n, const VectorIterator& it) { return VectorIterator { it.m_vector, it.m_index + n }; }
-        constexpr VectorIterator operator+(difference_type n) const { return n + *this; }
-        constexpr VectorIterator operator-(difference_type n) const { return *this + (-n); }
-
-        constexpr difference_type operator-(const VectorIterator& rhs) const { return m_index - rhs.m_index; }
-        constexpr difference_type operator-(const ConstVectorIterator<V>& rhs) const { return m_index - rhs.m_index; }
-        constexpr friend difference_type operator-(const ConstVectorIterator<V>& lhs, const VectorIterator& rhs) { return lhs.m_index - rhs.m_index; }
-        constexpr reference operator*() const { return m_vector->operator[](m_index); }
-        constexpr pointer operator->() const { return &m_vector->operator[](m_index); }
-        constexpr reference operator[](difference_type n) const { return m_vector->operator[](m_index + n); }
-        constexpr bool operator==(const VectorIterator& rhs) const { return m_index == rhs.m_index; }
-        constexpr auto operator<=>(const VectorIterator& rhs) const { return m_index <=> rhs.m_index; }
-        constexpr bool operator==(const ConstVectorIterator<V>& rhs) const { return m_index == rhs.m_index; }
-        constexpr auto operator<=>(const ConstVectorIterator<V>& rhs) const { return m_index <=> rhs.m_index; }
-        constexpr friend bool operator==(const ConstVectorIterator<V>& lhs, const VectorIterator& rhs) { return lhs.m_index == rhs.m_index; }
-        constexpr friend auto operator<=>(const ConstVectorIterator<V>& lhs, const VectorIterator& rhs) { return lhs.m_index <=> rhs.m_index; }
+        constexpr VectorIterator(const ConstVectorIterator<V>& it) : m_pointer(const_cast<pointer>(it.m_pointer)) {}
+
+        constexpr VectorIterator& operator++() { ++m_pointer; return *this; }
+        constexpr VectorIterator operator++(int) { auto tmp { *this }; ++m_pointer; return tmp; }
+        constexpr VectorIterator& operator--() { --m_pointer; return *this; }
+        constexpr VectorIterator operator--(int) { auto tmp { *this }; --m_pointer; return tmp; }
+
+        constexpr VectorIterator& operator+=(difference_type n) { m_pointer += n; return *this; }
+        constexpr VectorIterator& operator-=(difference_type n) { m_pointer -= n; return *this; }
+
+        constexpr friend VectorIterator operator+(difference_type n, const VectorIterator& it) { return VectorIterator { it.m_pointer + n }; }
+        constexpr VectorIterator operator+(difference_type n) const { return VectorIterator { m_pointer + n }; }
+        constexpr VectorIterator operator-(difference_type n) const { return VectorIterator { m_pointer - n }; }
+
+        constexpr difference_type operator-(const VectorIterator& rhs) const { return m_pointer - rhs.m_pointer; }
+        constexpr difference_type operator-(const ConstVectorIterator<V>& rhs) const { return m_pointer - rhs.m_pointer; }
+        constexpr friend difference_type operator-(const ConstVectorIterator<V>& lhs, const VectorIterator& rhs) { return lhs.m_pointer - rhs.m_pointer; }
+        constexpr reference operator*() const { return *m_pointer; }
+        constexpr pointer operator->() const { return m_pointer; }
+        constexpr reference operator[](difference_type n) const { return m_pointer[n]; }
+        constexpr bool operator==(const VectorIterator& rhs) const { return m_pointer == rhs.m_pointer; }
+        constexpr auto operator<=>(const VectorIterator& rhs) const { return m_pointer <=> rhs.m_pointer; }
+        constexpr bool operator==(const ConstVectorIterator<V>& rhs) const { return m_pointer == rhs.m_pointer; }
+        constexpr auto operator<=>(const ConstVectorIterator<V>& rhs) const { return static_cast<const value_type*>(m_pointer) <=> rhs.m_pointer; }
+        constexpr friend bool operator==(const ConstVectorIterator<V>& lhs, const VectorIterator& rhs) { return lhs.m_pointer == rhs.m_pointer; }
+        constexpr friend auto operator<=>(const ConstVectorIterator<V>& lhs, const VectorIterator& rhs) { return lhs.m_pointer <=> static_cast<const value_type*>(rhs.m_pointer); }
 
         // conversion to const iterator
-        constexpr operator ConstVectorIterator<V>() const { return ConstVectorIterator<V> { m_vector, m_index }; }
+        constexpr operator ConstVectorIterator<V>() const { return ConstVectorIterator<V> { m_pointer }; }
 
     };
 
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "../framework.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace dslab::vector {
+
+// a type is trivially relocatable if moving an object to a new address and ending the lifetime
+// of the old one is equivalent to copying its bytes
+// all trivially copyable types are, and so are the usual owning handles; specialize it for your own types
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T, typename D>
+struct is_trivially_relocatable<std::unique_ptr<T, D>> : is_trivially_relocatable<D> {};
+
+template <typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+
+template <typename T>
+struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type {};
+
+template <typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// raw memory blocks for vectors
+// small blocks come from malloc and can be resized by realloc,
+// large blocks are anonymous mappings (on Linux) and can be resized by mremap without copying
+class VectorMemory {
+public:
+    static constexpr std::size_t MAP_THRESHOLD { 1uz << 22 };
+
+    static bool mapped(std::size_t bytes) {
+#ifdef __linux__
+        return bytes >= MAP_THRESHOLD;
+#else
+        return false;
+#endif
+    }
+
+    static void* allocate(std::size_t bytes) {
+        if (bytes == 0) {
+            return nullptr;
+        }
+#ifdef __linux__
+        if (mapped(bytes)) {
+            auto p { mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc {};
+            }
+            return p;
+        }
+#endif
+        if (auto p { std::malloc(bytes) }; p != nullptr) {
+            return p;
+        }
+        throw std::bad_alloc {};
+    }
+
+    static void deallocate(void* p, std::size_t bytes) {
+        if (p == nullptr) {
+            return;
+        }
+#ifdef __linux__
+        if (mapped(bytes)) {
+            munmap(p, bytes);
+            return;
+        }
+#endif
+        std::free(p);
+    }
+
+    // resize the block, the first min(oldBytes, newBytes) bytes are kept
+    static void* reallocate(void* p, std::size_t oldBytes, std::size_t newBytes) {
+        if (p == nullptr) {
+            return allocate(newBytes);
+        }
+        if (newBytes == 0) {
+            deallocate(p, oldBytes);
+            return nullptr;
+        }
+        if (mapped(oldBytes) != mapped(newBytes)) {
+            auto q { allocate(newBytes) };
+            std::memcpy(q, p, std::min(oldBytes, newBytes));
+            deallocate(p, oldBytes);
+            return q;
+        }
+#ifdef __linux__
+        if (mapped(newBytes)) {
+            auto q { mremap(p, oldBytes, newBytes, MREMAP_MAYMOVE) };
+            if (q == MAP_FAILED) {
+                throw std::bad_alloc {};
+            }
+            return q;
+        }
+#endif
+        if (auto q { std::realloc(p, newBytes) }; q != nullptr) {
+            return q;
+        }
+        throw std::bad_alloc {};
+    }
+
+    // the hooks below are used by storage modes like VectorHugeMemory, and do nothing here
+
+    // whether the storage that has never been written (or has been released) reads as zero
+    static constexpr bool ZEROED { false };
+
+    // fault the pages of [p, p + bytes) in before they are written
+    static void prefault(void*, std::size_t) {}
+
+    // the bytes in [p, p + bytes) are no longer used, and may be given back to the system
+    static void release(void*, std::size_t) {}
+};
+
+// the memory resource that vectors constructed on this thread take their blocks from
+// nullptr (the default) means VectorMemory itself; otherwise, e.g. a monotonic arena or a pool can be installed
+// for a scope, and every vector created in it (including those inside stacks, lists and expressions) uses it
+// a vector keeps its resource for its whole life, so the resource must outlive the vectors created in the scope
+class VectorResource {
+    static inline thread_local std::pmr::memory_resource* s_current { nullptr };
+    std::pmr::memory_resource* m_previous;
+
+public:
+    explicit VectorResource(std::pmr::memory_resource* resource) : m_previous { s_current } {
+        s_current = resource;
+    }
+    ~VectorResource() {
+        s_current = m_previous;
+    }
+    VectorResource(const VectorResource&) = delete;
+    VectorResource& operator=(const VectorResource&) = delete;
+
+    static std::pmr::memory_resource* current() {
+        return s_current;
+    }
+};
+
+// the blocks of n elements of T for the vectors: from their resource if they have one, from M otherwise
+// over-aligned types cannot live in malloc blocks, they fall back to the standard allocator
+template <typename T, typename M = VectorMemory>
+class VectorBlock {
+public:
+    static constexpr bool ALIGNED { alignof(T) <= alignof(std::max_align_t) };
+
+    static std::size_t bytes(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::length_error("vector capacity exceeds the address space");
+        }
+        return n * sizeof(T);
+    }
+
+    static T* allocate(std::pmr::memory_resource* resource, std::size_t n) {
+        if (resource != nullptr) {
+            return n == 0 ? nullptr : static_cast<T*>(resource->allocate(bytes(n), alignof(T)));
+        }
+        if constexpr (ALIGNED) {
+            return static_cast<T*>(M::allocate(bytes(n)));
+        } else {
+            return n == 0 ? nullptr : std::allocator<T> {}.allocate(n);
+        }
+    }
+
+    static void deallocate(std::pmr::memory_resource* resource, T* p, std::size_t n) {
+        if (p == nullptr) {
+            return;
+        }
+        if (resource != nullptr) {
+            resource->deallocate(p, n * sizeof(T), alignof(T));
+        } else if constexpr (ALIGNED) {
+            M::deallocate(p, n * sizeof(T));
+        } else {
+            std::allocator<T> {}.deallocate(p, n);
+        }
+    }
+};
+
+}
\ No newline at end of file
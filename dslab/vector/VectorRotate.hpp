@@ -0,0 +1,155 @@
+#pragma once
+
+#include "AbstractVector.hpp"
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace dslab::vector {
+
+// cyclic shift of contiguous elements: [first, middle) and [middle, last) trade places, like std::rotate
+// the algorithm depends on the sizes (the short side is the smaller of the two parts):
+// - a short side of at most BUFFER bytes is moved out to a buffer, the rest is moved over, and the buffer is moved back
+// - a range of at most CACHE bytes is rotated by juggling (following the cycles of the shift, n moves in all),
+//   whose strided accesses are cheap once the whole range is in the cache
+// - a range larger than the last level cache with a long short side is rotated by three reversals,
+//   each split among several threads (a reversal swaps independent pairs, so the threads never meet)
+// - otherwise the short side is swapped block by block with the adjacent part of the long side (Gries-Mills),
+//   so that the accesses are sequential and the block being moved stays in the cache
+class VectorRotate {
+public:
+    static constexpr std::size_t BUFFER { 1uz << 16 };
+    static constexpr std::size_t CACHE { 1uz << 18 };
+
+    // each thread reverses at least this many bytes
+    static constexpr std::size_t PARALLEL_CHUNK { 1uz << 22 };
+
+    // the size of the last level cache, or 32 MiB if it is unknown
+    static std::size_t cacheSize() {
+        static const std::size_t size { [] {
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+            if (auto l3 { sysconf(_SC_LEVEL3_CACHE_SIZE) }; l3 > 0) {
+                return static_cast<std::size_t>(l3);
+            }
+#endif
+            return 1uz << 25;
+        }() };
+        return size;
+    }
+
+    template <typename T>
+    static void rotate(T* first, T* middle, T* last) {
+        auto left { static_cast<std::size_t>(middle - first) }, right { static_cast<std::size_t>(last - middle) };
+        if (left == 0 || right == 0) {
+            return;
+        }
+        auto n { left + right };
+        if (std::min(left, right) * sizeof(T) <= BUFFER) {
+            rotateBuffer(first, middle, last);
+        } else if (n * sizeof(T) <= CACHE) {
+            rotateJuggling(first, left, n);
+        } else if (n * sizeof(T) > cacheSize() && std::min(left, right) * sizeof(T) >= PARALLEL_CHUNK) {
+            reverse(first, middle);
+            reverse(middle, last);
+            reverse(first, last);
+        } else {
+            rotateBlocks(first, middle, last);
+        }
+    }
+
+    // shift the vector left by k (the element at rank k becomes the first), k <= size
+    template <typename T>
+    static void rotate(AbstractVector<T>& V, std::size_t k) {
+        if (V.size() > 0) {
+            auto first { std::to_address(V.begin()) };
+            rotate(first, first + k, first + V.size());
+        }
+    }
+
+    // reverse [first, last), in parallel if it is large enough
+    template <typename T>
+    static void reverse(T* first, T* last) {
+        auto pairs { static_cast<std::size_t>(last - first) / 2 };
+        auto threads { std::min<std::size_t>(std::thread::hardware_concurrency(), 2 * pairs * sizeof(T) / PARALLEL_CHUNK) };
+        if (threads <= 1) {
+            std::reverse(first, last);
+            return;
+        }
+        auto work { [=](std::size_t k) {
+            auto lo { pairs * k / threads }, hi { pairs * (k + 1) / threads };
+            std::swap_ranges(first + lo, first + hi, std::make_reverse_iterator(last - lo));
+        } };
+        std::vector<std::jthread> workers {};
+        for (auto k { 1uz }; k < threads; ++k) {
+            workers.emplace_back(work, k);
+        }
+        work(0);
+    }
+
+private:
+    template <typename T>
+    static void rotateBuffer(T* first, T* middle, T* last) {
+        auto left { static_cast<std::size_t>(middle - first) }, right { static_cast<std::size_t>(last - middle) };
+        auto m { std::min(left, right) };
+        std::allocator<T> allocator {};
+        auto buffer { allocator.allocate(m) };
+        if (left <= right) {
+            std::uninitialized_move(first, middle, buffer);
+            std::move(middle, last, first);
+            std::move(buffer, buffer + m, last - m);
+        } else {
+            std::uninitialized_move(middle, last, buffer);
+            std::move_backward(first, middle, last);
+            std::move(buffer, buffer + m, first);
+        }
+        std::destroy_n(buffer, m);
+        allocator.deallocate(buffer, m);
+    }
+
+    // the element at rank i + k goes to rank i, every cycle starts from one of the first gcd(n, k) ranks
+    template <typename T>
+    static void rotateJuggling(T* first, std::size_t k, std::size_t n) {
+        auto cycles { std::gcd(n, k) };
+        for (auto i { 0uz }; i < cycles; ++i) {
+            T tmp { std::move(first[i]) };
+            auto cur { i }, next { i + k };
+            while (next != i) {
+                first[cur] = std::move(first[next]);
+                cur = next;
+                next = next + k < n ? next + k : next + k - n;
+            }
+            first[cur] = std::move(tmp);
+        }
+    }
+
+    // swap the short side with the part of the long side next to it, which puts the short side in place,
+    // and rotate the rest the same way, until the short side fits the buffer
+    template <typename T>
+    static void rotateBlocks(T* first, T* middle, T* last) {
+        while (first != middle && middle != last) {
+            auto left { static_cast<std::size_t>(middle - first) }, right { static_cast<std::size_t>(last - middle) };
+            if (std::min(left, right) * sizeof(T) <= BUFFER) {
+                rotateBuffer(first, middle, last);
+                return;
+            }
+            if (left <= right) {
+                // [A B1 B2] with |B1| = |A| becomes [B1 A B2], then A B2 is rotated
+                std::swap_ranges(first, middle, middle);
+                first = middle;
+                middle += left;
+            } else {
+                // [A1 A2 B] with |A2| = |B| becomes [A1 B A2], then A1 B is rotated
+                std::swap_ranges(middle, last, middle - right);
+                last = middle;
+                middle -= right;
+            }
+        }
+    }
+};
+
+}
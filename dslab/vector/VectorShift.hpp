@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+namespace dslab::vector {
+
+// moving the tail of a vector to open or close a gap, for any vector whose elements are reached by a random access
+// iterator (Vector and SmallVector on T*, SegmentedVector on its own iterators)
+// the elements live in [first, last), and opening a gap of n needs the storage of the n slots after last
+// an insert is open, then copy or fill: if an element of the gap cannot be copied, the tail is moved back,
+// so the vector holds its old elements again (its capacity may have grown), as long as moving T does not throw
+class VectorShift {
+    // undo open(p, last, n), once the slots of the gap beyond the live ones are raw storage again
+    template <std::random_access_iterator It>
+    static void shut(It p, It last, std::size_t n) {
+        auto tail { static_cast<std::size_t>(last - p) };
+        std::move(p + n, last + n, p);
+        std::destroy(p + std::max(tail, n), last + n);
+    }
+
+public:
+    // move [p, last) n slots forward: the elements that land beyond last are moved into raw storage,
+    // the others are moved backward
+    // returns how many slots at the start of the gap [p, p + n) still hold (moved-from) elements,
+    // those must be assigned and the rest constructed, see copy and fill
+    template <std::random_access_iterator It>
+    static std::size_t open(It p, It last, std::size_t n) {
+        if (n == 0) {
+            return 0;
+        }
+        auto tail { static_cast<std::size_t>(last - p) };
+        if (tail > n) {
+            std::uninitialized_move(last - n, last, last);
+            std::move_backward(p, last - n, last);
+            return n;
+        }
+        std::uninitialized_move(p, last, p + n);
+        return tail;
+    }
+
+    // put the n elements from src into the gap [p, p + n) opened by open(p, last, n), whose first live slots hold elements
+    template <std::random_access_iterator It, std::input_iterator I>
+    static void copy(It p, It last, std::size_t n, std::size_t live, I src) {
+        try {
+            for (auto i { 0uz }; i < live; ++i, ++src) {
+                p[i] = *src;
+            }
+            std::uninitialized_copy_n(src, n - live, p + live);
+        } catch (...) {
+            shut(p, last, n);
+            throw;
+        }
+    }
+
+    // put n copies of e into the gap [p, p + n) opened by open(p, last, n), whose first live slots hold elements
+    template <std::random_access_iterator It, typename T>
+    static void fill(It p, It last, std::size_t n, std::size_t live, const T& e) {
+        try {
+            std::fill_n(p, live, e);
+            std::uninitialized_fill_n(p + live, n - live, e);
+        } catch (...) {
+            shut(p, last, n);
+            throw;
+        }
+    }
+
+    // move [q, last) backward onto [p, q) and destroy the n = q - p elements left at the end
+    // returns the new end, last - n
+    template <std::random_access_iterator It>
+    static It close(It p, It q, It last) {
+        if (p == q) {
+            return last;
+        }
+        auto end { std::move(q, last, p) };
+        std::destroy(end, last);
+        return end;
+    }
+};
+
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "AbstractVector.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dslab::vector {
+
+// uniform random shuffle of contiguous elements, by scattering them to random buckets (Rao-Sandelius)
+// - every element is sent to a bucket chosen uniformly and independently, the buckets are laid out in order
+// - every bucket is shuffled by Fisher-Yates, which is uniform given the sizes of the buckets, so the whole is uniform
+// the buckets are about BUCKET bytes, so each one is shuffled in the cache, and the random accesses of Fisher-Yates
+// over the whole range become sequential writes to a few thousand buckets
+// the input is split into chunks of CHUNK elements, and both the chunks and the buckets are handed out to several threads
+// every chunk and every bucket draws from its own stream of the seed (see Xoshiro256), and the chunks depend on n only,
+// so the permutation depends on the seed only, not on the number of threads
+// the scatter needs a buffer of n elements, the elements are moved there and back
+class VectorShuffle {
+public:
+    // a range of at most this many bytes is a single bucket, shuffled in place
+    static constexpr std::size_t BUCKET { 1uz << 18 };
+
+    // more buckets would not fit their write positions in the cache (and the TLB), the buckets grow instead
+    static constexpr std::size_t MAX_BUCKETS { 1uz << 12 };
+
+    // the elements scattered by a task
+    static constexpr std::size_t CHUNK { 1uz << 20 };
+
+    template <typename T>
+    static void shuffle(T* first, T* last, std::uint64_t seed) {
+        auto n { static_cast<std::size_t>(last - first) };
+        auto buckets { std::min((n * sizeof(T) + BUCKET - 1) / BUCKET, MAX_BUCKETS) };
+        if (buckets <= 1) {
+            Xoshiro256 engine { seed };
+            fisherYates(first, n, engine);
+            return;
+        }
+        auto chunks { (n + CHUNK - 1) / CHUNK };
+
+        // count[c * buckets + b] is the number of elements of chunk c sent to bucket b,
+        // it becomes the position in the buffer where chunk c writes its elements of bucket b
+        std::vector<std::size_t> count(chunks * buckets);
+        parallel(chunks, [&](std::size_t c) {
+            auto engine { chunkEngine(seed, c) };
+            auto cnt { count.data() + c * buckets };
+            for (auto i { c * CHUNK }, end { std::min(i + CHUNK, n) }; i < end; ++i) {
+                ++cnt[Random::bounded(engine, buckets)];
+            }
+        });
+        std::vector<std::size_t> start(buckets + 1);
+        for (auto b { 0uz }, pos { 0uz }; b < buckets; ++b) {
+            start[b] = pos;
+            for (auto c { 0uz }; c < chunks; ++c) {
+                pos += std::exchange(count[c * buckets + b], pos);
+            }
+        }
+        start[buckets] = n;
+
+        std::allocator<T> allocator {};
+        auto buffer { allocator.allocate(n) };
+        // the same draws again, now the elements are moved
+        parallel(chunks, [&](std::size_t c) {
+            auto engine { chunkEngine(seed, c) };
+            auto pos { count.data() + c * buckets };
+            for (auto i { c * CHUNK }, end { std::min(i + CHUNK, n) }; i < end; ++i) {
+                std::construct_at(buffer + pos[Random::bounded(engine, buckets)]++, std::move(first[i]));
+            }
+        });
+        parallel(buckets, [&](std::size_t b) {
+            auto engine { bucketEngine(seed, b) };
+            auto lo { start[b] }, size { start[b + 1] - start[b] };
+            fisherYates(buffer + lo, size, engine);
+            std::move(buffer + lo, buffer + lo + size, first + lo);
+            std::destroy_n(buffer + lo, size);
+        });
+        allocator.deallocate(buffer, n);
+    }
+
+    template <typename T>
+    static void shuffle(AbstractVector<T>& V, std::uint64_t seed) {
+        if (V.size() > 0) {
+            auto first { std::to_address(V.begin()) };
+            shuffle(first, first + V.size(), seed);
+        }
+    }
+
+    // seeded from Random
+    template <typename T>
+    static void shuffle(AbstractVector<T>& V) {
+        shuffle(V, Random::get());
+    }
+
+private:
+    // the streams of the engines: 0 for a single bucket, 2c + 1 for chunk c, 2b + 2 for bucket b
+    static Xoshiro256 chunkEngine(std::uint64_t seed, std::size_t c) {
+        return Xoshiro256 { seed, 2 * c + 1 };
+    }
+    static Xoshiro256 bucketEngine(std::uint64_t seed, std::size_t b) {
+        return Xoshiro256 { seed, 2 * b + 2 };
+    }
+
+    template <typename T>
+    static void fisherYates(T* first, std::size_t n, Xoshiro256& engine) {
+        for (auto i { n }; i > 1; --i) {
+            std::swap(first[i - 1], first[Random::bounded(engine, i)]);
+        }
+    }
+
+    // run f(0), ..., f(tasks - 1), each thread takes the next task when it is done with one
+    template <typename F>
+    static void parallel(std::size_t tasks, F&& f) {
+        std::atomic<std::size_t> next { 0 };
+        auto work { [&] {
+            for (auto k { next++ }; k < tasks; k = next++) {
+                f(k);
+            }
+        } };
+        auto threads { std::min<std::size_t>(std::thread::hardware_concurrency(), tasks) };
+        std::vector<std::jthread> workers {};
+        for (auto k { 1uz }; k < threads; ++k) {
+            workers.emplace_back(work);
+        }
+        work();
+    }
+};
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../framework.hpp"
+#include <chrono>
+
+namespace dslab::vector {
+
+// the counters of a vector, pass VectorStats as the S parameter of Vector to turn them on
+// they are updated whenever the vector moves its elements to another block (growing, reserve, shrinking),
+// and belong to the vector object: copying or moving a vector does not carry them over
+// the default, VectorNoStats, holds nothing and every update of it is compiled out
+struct VectorStats {
+    static constexpr bool ENABLED { true };
+
+    // the number of times the elements were moved to another block
+    std::size_t m_reallocations { 0 };
+
+    // the elements moved one by one (by the move constructor) to a new block
+    std::size_t m_movedElements { 0 };
+
+    // the bytes of the blocks resized by M::reallocate, which copies or remaps them
+    std::size_t m_copiedBytes { 0 };
+
+    std::size_t m_peakCapacity { 0 };
+
+    // the time spent moving to new blocks, including the allocation
+    std::chrono::nanoseconds m_reserveTime { 0 };
+};
+
+struct VectorNoStats {
+    static constexpr bool ENABLED { false };
+};
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "vector.hpp"
+#include <algorithm>
+
+// fixtures shared by the labs, include it as "../fixtures.hpp"
+
+// the same payload as std::size_t, but opted out of relocation,
+// so that the vector has to move it element by element into a fresh block
+struct PinnedItem {
+    std::size_t m_value { 0 };
+    PinnedItem() = default;
+    PinnedItem(std::size_t value) : m_value(value) {}
+    bool operator==(const PinnedItem& other) const = default;
+};
+
+template <>
+struct dslab::vector::is_trivially_relocatable<PinnedItem> : std::false_type {};
+
+// a growth policy that counts how many times the container gets a block of another capacity,
+// i.e. how many heap (re)allocations the container makes, and how many elements are moved to the new blocks
+template <typename A>
+class CountingAllocator : public A {
+public:
+    static inline std::size_t s_count { 0 };
+    static inline std::size_t s_moved { 0 };
+    std::size_t operator()(std::size_t capacity, std::size_t size) override {
+        auto result { A::operator()(capacity, size) };
+        if (result != capacity) {
+            ++s_count;
+            s_moved += std::min(size, result);
+        }
+        return result;
+    }
+};
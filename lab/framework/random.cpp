@@ -0,0 +1,102 @@
+#include "framework.hpp"
+#include <thread>
+#include <vector>
+
+using namespace dslab;
+
+// generate n random numbers in [0, 999] (the test data of a lab), and return their sum
+// - std::mt19937 with a uniform_int_distribution rebuilt for every number, as Random used to do
+// - Random::get one by one, the thread's xoshiro256** engine and Lemire's bounded numbers
+// - Random::get from a Philox4x32 (counter-based) engine
+// - Random::fill, 8 numbers at once with AVX2
+
+using Generate = Algorithm<std::size_t(std::size_t)>;
+
+class GenerateMT : public Generate {
+    std::mt19937 m_engine { 0 };
+    std::uniform_int_distribution<std::size_t> m_distribution {};
+public:
+    std::size_t operator()(std::size_t n) override {
+        std::vector<int> data(n);
+        for (auto& x : data) {
+            x = static_cast<int>(m_distribution(m_engine, decltype(m_distribution)::param_type(0, 999)));
+        }
+        return std::accumulate(data.begin(), data.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return "std::mt19937";
+    }
+};
+
+template <typename R>
+class GenerateGet : public Generate {
+public:
+    std::size_t operator()(std::size_t n) override {
+        std::vector<int> data(n);
+        for (auto& x : data) {
+            x = static_cast<int>(R::get(999));
+        }
+        return std::accumulate(data.begin(), data.end(), 0uz);
+    }
+    std::string type_name() const override {
+        if constexpr (std::is_same_v<typename R::engine_type, Philox4x32>) {
+            return "Random::get (Philox4x32)";
+        } else {
+            return "Random::get (xoshiro256**)";
+        }
+    }
+};
+
+class GenerateFill : public Generate {
+public:
+    std::size_t operator()(std::size_t n) override {
+        std::vector<int> data(n);
+        Random::fill(std::span { data }, 0, 999);
+        return std::accumulate(data.begin(), data.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return "Random::fill";
+    }
+};
+
+TestFramework<Generate,
+    GenerateMT,
+    GenerateGet<Random>,
+    GenerateGet<BasicRandom<Philox4x32>>,
+    GenerateFill> test;
+
+std::vector testData { 1'000'000uz, 10'000'000uz, 100'000'000uz };
+
+// threads that bind their task index draw the numbers of that stream, whatever the order they start in
+void checkStreams() {
+    Random::seed(42);
+    std::vector<std::vector<std::size_t>> drawn(4);
+    {
+        std::vector<std::jthread> threads {};
+        for (auto k { 0uz }; k < drawn.size(); ++k) {
+            threads.emplace_back([k, &drawn] {
+                Random::bind(k);
+                for (auto i { 0 }; i < 1000; ++i) {
+                    drawn[k].push_back(Random::get());
+                }
+            });
+        }
+    }
+    for (auto k { 0uz }; k < drawn.size(); ++k) {
+        auto engine { Random::stream(k) };
+        for (auto x : drawn[k]) {
+            if (x != engine()) {
+                throw std::runtime_error("bound stream error");
+            }
+        }
+    }
+}
+
+int main() {
+    checkStreams();
+    for (auto n : testData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        test(n);
+    }
+    return 0;
+}
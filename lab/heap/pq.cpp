@@ -0,0 +1,159 @@
+#include "heap.hpp"
+#include "sort.hpp"
+#include <queue>
+
+using namespace dslab;
+
+// a scheduler keeps n pending tasks ordered by priority: it takes out the most urgent one and puts in a new one,
+// n times (the hold model), then drains the queue; the result is the sum of the priorities taken out
+// - sorted insertion into a Vector (the most urgent at the back), O(n) per insertion
+// - std::priority_queue
+// - PriorityQueue on a binary, 4-ary and 8-ary heap
+// then the same PriorityQueue is built from n elements by push_range (Floyd's construction),
+// and HeapSort on the three heaps is compared with QuickSort
+
+using Schedule = Algorithm<std::size_t(const std::vector<std::size_t>&)>;
+
+class ScheduleVector : public Schedule {
+public:
+    std::size_t operator()(const std::vector<std::size_t>& priorities) override {
+        auto n { priorities.size() / 2 };
+        Vector<std::size_t> V {};
+        auto insert { [&](std::size_t p) { V.insert(std::lower_bound(V.begin(), V.end(), p), p); } };
+        for (auto i { 0uz }; i < n; ++i) {
+            insert(priorities[i]);
+        }
+        auto sum { 0uz };
+        for (auto i { n }; i < 2 * n; ++i) {
+            sum += V.pop_back();
+            insert(priorities[i]);
+        }
+        while (!V.empty()) {
+            sum += V.pop_back();
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return "Vector (sorted insertion)";
+    }
+};
+
+class ScheduleStd : public Schedule {
+public:
+    std::size_t operator()(const std::vector<std::size_t>& priorities) override {
+        auto n { priorities.size() / 2 };
+        std::priority_queue<std::size_t> Q {};
+        for (auto i { 0uz }; i < n; ++i) {
+            Q.push(priorities[i]);
+        }
+        auto sum { 0uz };
+        for (auto i { n }; i < 2 * n; ++i) {
+            sum += Q.top();
+            Q.pop();
+            Q.push(priorities[i]);
+        }
+        while (!Q.empty()) {
+            sum += Q.top();
+            Q.pop();
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return "std::priority_queue";
+    }
+};
+
+template <std::size_t D>
+class ScheduleHeap : public Schedule {
+public:
+    std::size_t operator()(const std::vector<std::size_t>& priorities) override {
+        auto n { priorities.size() / 2 };
+        PriorityQueue<std::size_t, std::less<std::size_t>, D> Q {};
+        for (auto i { 0uz }; i < n; ++i) {
+            Q.push(priorities[i]);
+        }
+        auto sum { 0uz };
+        for (auto i { n }; i < 2 * n; ++i) {
+            sum += Q.pop();
+            Q.push(priorities[i]);
+        }
+        for (auto x : Q.pop_n(n)) {
+            sum += x;
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return std::format("PriorityQueue ({}-ary)", D);
+    }
+};
+
+template <std::size_t D>
+class BuildHeap : public Schedule {
+public:
+    std::size_t operator()(const std::vector<std::size_t>& priorities) override {
+        PriorityQueue<std::size_t, std::less<std::size_t>, D> Q { priorities };
+        return Q.top();
+    }
+    std::string type_name() const override {
+        return std::format("PriorityQueue ({}-ary) push_range", D);
+    }
+};
+
+template <typename Sort>
+class SortPriorities : public Schedule {
+    Sort sorter {};
+public:
+    std::size_t operator()(const std::vector<std::size_t>& priorities) override {
+        Vector<std::size_t> V(priorities.size());
+        std::copy(priorities.begin(), priorities.end(), V.begin());
+        sorter(V);
+        return std::is_sorted(V.begin(), V.end()) ? V.back() : 0;
+    }
+    std::string type_name() const override {
+        return sorter.type_name();
+    }
+};
+
+TestFramework<Schedule,
+    ScheduleVector,
+    ScheduleStd,
+    ScheduleHeap<2>,
+    ScheduleHeap<4>,
+    ScheduleHeap<8>> schedule;
+
+// sorted insertion takes too long from here on
+constexpr std::size_t VECTOR_LIMIT { 100'000 };
+
+TestFramework<Schedule,
+    ScheduleStd,
+    ScheduleHeap<2>,
+    ScheduleHeap<4>,
+    ScheduleHeap<8>> scheduleHeaps;
+
+TestFramework<Schedule,
+    BuildHeap<2>,
+    BuildHeap<4>,
+    BuildHeap<8>,
+    SortPriorities<HeapSort<std::size_t, DefaultVector, 2>>,
+    SortPriorities<HeapSort<std::size_t, DefaultVector, 4>>,
+    SortPriorities<HeapSort<std::size_t, DefaultVector, 8>>,
+    SortPriorities<QuickSort<std::size_t, DefaultVector>>> build;
+
+std::vector testData { 10'000uz, 100'000uz, 1'000'000uz };
+
+int main() {
+    for (auto n : testData) {
+        std::vector<std::size_t> priorities(2 * n);
+        for (auto& p : priorities) {
+            p = Random::get(n * n);
+        }
+        std::cout << std::format("n = {}", n) << std::endl;
+        if (n <= VECTOR_LIMIT) {
+            schedule(priorities);
+        } else {
+            scheduleHeaps(priorities);
+        }
+        build(priorities);
+    }
+    return 0;
+}
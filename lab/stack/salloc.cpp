@@ -0,0 +1,150 @@
+#include "expression.hpp"
+#include "stack.hpp"
+#include "../fixtures.hpp"
+
+using namespace dslab;
+using namespace std::literals::string_literals;
+
+using Policy = CountingAllocator<VectorAllocatorGP<std::ratio<3, 2>>>;
+
+template <typename T>
+using HeapVector = Vector<T, Policy>;
+
+template <typename T>
+using SmallVector4 = SmallVector<T, 4, Policy>;
+
+template <typename T>
+using SmallVector16 = SmallVector<T, 16, Policy>;
+
+// each problem runs a workload many times with fresh containers, and returns the number of allocations
+class AllocProblem : public Algorithm<std::size_t(std::size_t)> {
+protected:
+    virtual void run(std::size_t times) = 0;
+public:
+    std::size_t operator()(std::size_t times) override {
+        Policy::s_count = 0;
+        run(times);
+        return Policy::s_count;
+    }
+};
+
+template <template<typename> typename L>
+class AllocName {
+public:
+    static std::string name(std::string_view workload) {
+        return std::format("{:<14} {}", workload, L<int> {}.type_name());
+    }
+};
+
+std::vector expressions { "(1+2^3*45)%67-8*9"s, "-1-23*4^5-6!+7*8!/9"s, "(-1-(2+3*(45/6-7!))+8)*9"s };
+
+template <template<typename> typename L>
+class ExprInfix : public AllocProblem {
+protected:
+    void run(std::size_t times) override {
+        for (auto i { 0uz }; i < times; ++i) {
+            Expression<int, L> e { expressions[i % expressions.size()] };
+            if (e.calInfix() == 0) {
+                throw std::runtime_error("wrong result");
+            }
+        }
+    }
+public:
+    std::string type_name() const override {
+        return AllocName<L>::name("Expr (Infix)");
+    }
+};
+
+template <template<typename> typename L>
+class ExprSuffix : public AllocProblem {
+protected:
+    void run(std::size_t times) override {
+        for (auto i { 0uz }; i < times; ++i) {
+            Expression<int, L> e { expressions[i % expressions.size()] };
+            e.infix2suffix();
+            if (e.calSuffix() == 0) {
+                throw std::runtime_error("wrong result");
+            }
+        }
+    }
+public:
+    std::string type_name() const override {
+        return AllocName<L>::name("Expr (Suffix)");
+    }
+};
+
+// a short-lived stack holding a handful of elements
+template <template<typename> typename L>
+class ShortStack : public AllocProblem {
+protected:
+    void run(std::size_t times) override {
+        for (auto i { 0uz }; i < times; ++i) {
+            Stack<std::size_t, L> S;
+            for (auto j { 0uz }; j < i % 12; ++j) {
+                S.push(j);
+            }
+            while (!S.empty()) {
+                S.pop();
+            }
+        }
+    }
+public:
+    std::string type_name() const override {
+        return AllocName<L>::name("Stack (0..11)");
+    }
+};
+
+// the rolling array of lab/stack/comb.cpp, one temporary row per level
+// the rows are built by push_back, so that every allocation goes through the growth policy
+template <template<typename> typename L>
+class CombRows : public AllocProblem {
+protected:
+    L<int> comb(int n) {
+        if (n == 0) {
+            return L<int> { 1 };
+        }
+        auto prev { comb(n - 1) };
+        L<int> ans;
+        ans.push_back(1);
+        for (int i = 1; i < n; i++) {
+            ans.push_back(prev[i - 1] + prev[i]);
+        }
+        ans.push_back(1);
+        return ans;
+    }
+    void run(std::size_t times) override {
+        for (auto i { 0uz }; i < times; ++i) {
+            if (comb(20)[10] != 184756) {
+                throw std::runtime_error("wrong result");
+            }
+        }
+    }
+public:
+    std::string type_name() const override {
+        return AllocName<L>::name("Comb (n = 20)");
+    }
+};
+
+TestFramework<AllocProblem,
+    ExprInfix<HeapVector>,
+    ExprInfix<SmallVector4>,
+    ExprInfix<SmallVector16>,
+    ExprSuffix<HeapVector>,
+    ExprSuffix<SmallVector4>,
+    ExprSuffix<SmallVector16>,
+    ShortStack<HeapVector>,
+    ShortStack<SmallVector4>,
+    ShortStack<SmallVector16>,
+    CombRows<HeapVector>,
+    CombRows<SmallVector4>,
+    CombRows<SmallVector16>> test;
+
+std::vector testTimes { 1000, 100'000 };
+
+int main() {
+    for (auto n : testTimes) {
+        std::cout << std::format("{} times", n) << std::endl;
+        test(n);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -30,6 +30,18 @@ public:
     }
 };
 
+// scatter to random buckets and shuffle each bucket, on several threads, see VectorShuffle
+template <typename T>
+class ShuffleBuckets : public Shuffle<T> {
+public:
+    void operator()(Vector<T>& V) override {
+        VectorShuffle::shuffle(V);
+    }
+    std::string type_name() const override {
+        return "Random Shuffle (VectorShuffle)";
+    }
+};
+
 using ShuffleTestProblem = Algorithm<void()>;
 
 template <std::size_t N, std::size_t C, typename T, template<typename> typename S>
@@ -37,7 +49,7 @@ template <std::size_t N, std::size_t C, typename T, template<typename> typename
 class ShuffleTest : public ShuffleTestProblem {
     Vector<T> m_vector;
     Vector<std::size_t> m_counter;
-    Factorial m_factorial;
+    Factorial<std::size_t> m_factorial;
     S<T> m_shuffle;
 
     std::size_t getRank() {
@@ -83,9 +95,24 @@ public:
 
 TestFramework<ShuffleTestProblem,
     ShuffleTest<4, 100'0000, int, ShuffleBasic>,
-    ShuffleTest<4, 100'0000, int, ShuffleStd>> test;
+    ShuffleTest<4, 100'0000, int, ShuffleStd>,
+    ShuffleTest<4, 100'0000, int, ShuffleBuckets>> test;
+
+// the time to shuffle large vectors, and the elements shuffled per second
+template <typename T>
+void throughput(std::size_t n) {
+    TestFramework<Shuffle<T>, ShuffleBasic<T>, ShuffleStd<T>, ShuffleBuckets<T>> test;
+    Vector<T> V(n);
+    std::iota(V.begin(), V.end(), 0);
+    std::cout << std::format("n = {}, {} bytes per element", n, sizeof(T)) << std::endl;
+    test(std::ref(V));
+    auto time { reportProcedureTime([&] { VectorShuffle::shuffle(V); }) };
+    std::cout << std::format("VectorShuffle: {:.1f} M elements/s", n / time / 1e6) << std::endl;
+}
 
 int main() {
     test();
+    throughput<int>(100'000'000);
+    throughput<std::uint8_t>(1'000'000'000);
     return 0;
 }
\ No newline at end of file
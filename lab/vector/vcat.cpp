@@ -1,4 +1,5 @@
 #include "vector.hpp"
+#include "../fixtures.hpp"
 
 using namespace dslab;
 
@@ -46,6 +47,19 @@ public:
     }
 };
 
+template <typename T>
+class VectorConcatRange : public VectorConcat<T> {
+    using VectorConcat<T>::V, VectorConcat<T>::W;
+public:
+    Vector<T>& operator()(std::size_t r) override {
+        V.insert(V.begin() + r, std::make_move_iterator(W.begin()), std::make_move_iterator(W.end()));
+        return V;
+    }
+    std::string type_name() const override {
+        return "Concat (Range Insert)";
+    }
+};
+
 std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> testData {
     { 20'0000, 100, 0 }, // insert a few elements at the beginning
     { 20'0000, 100'000, 0 }, // insert a lot of elements at the beginning
@@ -53,9 +67,88 @@ std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> testData {
     { 20'0000, 100'000, 20'0000 } // insert a lot of elements at the end
 };
 
-TestFramework<VectorConcat<int>, VectorConcatBasic<int>, VectorConcatFast<int>> test;
+TestFramework<VectorConcat<int>, VectorConcatBasic<int>, VectorConcatFast<int>, VectorConcatRange<int>> test;
+
+// an element whose copy throws once the countdown runs out, and which counts the live objects
+struct Fragile {
+    static inline std::size_t s_live { 0 };
+    static inline std::size_t s_countdown { 0 };
+    std::size_t m_value { 0 };
+    Fragile() { ++s_live; }
+    Fragile(std::size_t value) : m_value { value } { ++s_live; }
+    Fragile(const Fragile& other) : m_value { other.m_value } {
+        if (s_countdown > 0 && --s_countdown == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        ++s_live;
+    }
+    Fragile(Fragile&& other) noexcept : m_value { other.m_value } { ++s_live; }
+    Fragile& operator=(const Fragile& other) {
+        if (s_countdown > 0 && --s_countdown == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        m_value = other.m_value;
+        return *this;
+    }
+    Fragile& operator=(Fragile&& other) noexcept = default;
+    bool operator==(const Fragile& other) const = default;
+    ~Fragile() { --s_live; }
+};
+
+// a range insert whose k-th copy throws leaves the old elements in place, and nothing constructed beyond them
+template <typename V>
+void checkThrowingInsert() {
+    std::vector<Fragile> src(5, Fragile { 100 });
+    for (auto r : { 0uz, 3uz, 7uz, 10uz }) {
+        for (auto k { 1uz }; k <= src.size(); ++k) {
+            V v {};
+            for (auto i { 0uz }; i < 10; ++i) {
+                v.push_back(Fragile { i });
+            }
+            auto live { Fragile::s_live };
+            Fragile::s_countdown = k;
+            try {
+                v.insert(v.begin() + r, src.begin(), src.end());
+                throw std::logic_error("no copy failed");
+            } catch (const std::runtime_error&) {}
+            Fragile::s_countdown = 0;
+            if (v.size() != 10 || Fragile::s_live != live) {
+                throw std::runtime_error("range insert leaked");
+            }
+            for (auto i { 0uz }; i < 10; ++i) {
+                if (v[i].m_value != i) {
+                    throw std::runtime_error("range insert lost the tail");
+                }
+            }
+        }
+    }
+}
+
+// append_range and assign count the range, so they take one block of the exact size like insert does
+// (one by one, they would grow the block geometrically, 18 times for 1000 elements)
+template <typename V, typename A>
+void checkAppend() {
+    std::vector<int> src(1000, 1);
+    V v {};
+    A::s_count = 0;
+    v.append_range(src);
+    v.assign(src.begin(), src.end());
+    if (A::s_count > 1 || v.capacity() != src.size() || v.size() != src.size()) {
+        throw std::runtime_error("append_range reallocated more than once");
+    }
+}
+
+void checkRange() {
+    checkThrowingInsert<Vector<Fragile>>();
+    checkThrowingInsert<SmallVector<Fragile, 16>>();
+    checkThrowingInsert<SegmentedVector<Fragile>>();
+    using A = CountingAllocator<VectorAllocatorGP<std::ratio<3, 2>>>;
+    checkAppend<Vector<int, A>, A>();
+    checkAppend<SmallVector<int, 8, A>, A>();
+}
 
 int main() {
+    checkRange();
     for (auto [n, m, r] : testData) {
         std::cout << std::format("n = {:>7}, m = {:>7}, r = {:>7}", n, m, r) << std::endl;
         test.run([n, m](auto& algo) { algo.initialize(n, m); });
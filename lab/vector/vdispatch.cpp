@@ -0,0 +1,155 @@
+#include "vector.hpp"
+#include "stack.hpp"
+#include "sort.hpp"
+#include "search.hpp"
+#include <numeric>
+
+using namespace dslab;
+
+// the same workloads on Vector (virtual dispatch) and FinalVector (static dispatch)
+// each one is plugged in through the L parameter of the structure or the algorithm
+// note: when a vector is a local or a member, the compiler knows its dynamic type and devirtualizes Vector as well,
+// so the loops below receive the vector by reference from a function that is not inlined,
+// which is what a sort or a search sees when it is called from another translation unit
+
+class DispatchProblem : public Algorithm<std::size_t(std::size_t)> {};
+
+template <template<typename> typename L>
+class DispatchName {
+public:
+    static std::string name(std::string_view workload) {
+        return std::format("{:<18} {}", workload, L<int> {}.type_name());
+    }
+};
+
+// push n elements into a stack and pop them again
+template <template<typename> typename L>
+class StackPushPop : public DispatchProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        Stack<std::size_t, L> S;
+        for (auto i { 0uz }; i < n; ++i) {
+            S.push(i);
+        }
+        auto sum { 0uz };
+        while (S.size() > 0) {
+            sum += S.pop();
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return DispatchName<L>::name("Stack push/pop");
+    }
+};
+
+// push n elements to the back of the vector and pop them again
+template <template<typename> typename L>
+class VectorPushPop : public DispatchProblem {
+    L<std::size_t> V;
+    [[gnu::noinline]] static std::size_t run(L<std::size_t>& V, std::size_t n) {
+        for (auto i { 0uz }; i < n; ++i) {
+            V.push_back(i);
+        }
+        auto sum { 0uz };
+        while (V.size() > 0) {
+            sum += V.pop_back();
+        }
+        return sum;
+    }
+public:
+    std::size_t operator()(std::size_t n) override {
+        return run(V, n);
+    }
+    std::string type_name() const override {
+        return DispatchName<L>::name("Vector push/pop");
+    }
+};
+
+// walk the vector by rank
+template <template<typename> typename L>
+class IndexedSum : public DispatchProblem {
+    L<std::size_t> V;
+    [[gnu::noinline]] static std::size_t run(const L<std::size_t>& V) {
+        auto sum { 0uz };
+        for (auto k { 0 }; k < 10; ++k) {
+            for (auto i { 0uz }; i < V.size(); ++i) {
+                sum += V[i];
+            }
+        }
+        return sum;
+    }
+public:
+    std::size_t operator()(std::size_t n) override {
+        V.resize(n);
+        for (auto i { 0uz }; i < n; ++i) {
+            V[i] = i;
+        }
+        return run(V);
+    }
+    std::string type_name() const override {
+        return DispatchName<L>::name("Indexed sum x10");
+    }
+};
+
+// sort a shuffled permutation
+template <template<typename> typename L>
+class SortShuffled : public DispatchProblem {
+    MergeSort<std::size_t, L> sorter;
+public:
+    std::size_t operator()(std::size_t n) override {
+        L<std::size_t> V;
+        V.resize(n);
+        std::iota(V.begin(), V.end(), 0);
+        std::shuffle(V.begin(), V.end(), Random::engine());
+        sorter(V);
+        if (!std::is_sorted(V.begin(), V.end())) {
+            throw std::runtime_error("Merge sort failed");
+        }
+        return V.back();
+    }
+    std::string type_name() const override {
+        return DispatchName<L>::name("Merge sort");
+    }
+};
+
+// look up every element of a sorted vector
+template <template<typename> typename L>
+class SearchAll : public DispatchProblem {
+    BinarySearch<std::size_t, L> searcher;
+public:
+    std::size_t operator()(std::size_t n) override {
+        L<std::size_t> V;
+        V.resize(n);
+        std::iota(V.begin(), V.end(), 0);
+        auto found { 0uz };
+        for (auto i { 0uz }; i < n; ++i) {
+            found += *searcher(V, i) == i;
+        }
+        return found;
+    }
+    std::string type_name() const override {
+        return DispatchName<L>::name("Binary search all");
+    }
+};
+
+TestFramework<DispatchProblem,
+    StackPushPop<DefaultVector>,
+    StackPushPop<DefaultFinalVector>,
+    VectorPushPop<DefaultVector>,
+    VectorPushPop<DefaultFinalVector>,
+    IndexedSum<DefaultVector>,
+    IndexedSum<DefaultFinalVector>,
+    SortShuffled<DefaultVector>,
+    SortShuffled<DefaultFinalVector>,
+    SearchAll<DefaultVector>,
+    SearchAll<DefaultFinalVector>> test;
+
+std::vector testData { 1'000, 100'000, 1'000'000, 10'000'000 };
+
+int main() {
+    for (auto n : testData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        test(n);
+    }
+    return 0;
+}
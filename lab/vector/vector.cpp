@@ -1,4 +1,6 @@
 #include "vector.hpp"
+#include "stack.hpp"
+#include <chrono>
 
 using dslab::Algorithm;
 using dslab::TestItem;
@@ -11,14 +13,19 @@ using Vector = dslab::DefaultVector<T>;
 
 // test process:
 // 1. create an empty vector, size=0, capacity=0
-// 2. modify capacity to N, size=0, capacity=N
+// 2. modify capacity to N, no element constructed, size=0, capacity=N
 // 3. insert N elements at the end (copy), no move, size=N, capacity unchanged
 // 4. insert N elements at random position (move), no copy, size=2N
-// 5. remove N elements at random position, no copy, size=N
-// 6. find N elements at random position, no move or copy, size, capacity unchanged
-// 7. call copy constructor, no move, same before and after
-// 8. call move constructor, no copy or move, same before and after
-// 9. modify size to decrease, no move or copy, size decrease
+// 5. expand capacity, every element moved exactly once, nothing default-constructed
+// 6. remove N elements at random position, no copy, size=N
+// 7. find N elements at random position, no move or copy, size, capacity unchanged
+// 8. call copy constructor, every element copied exactly once, no move, same before and after
+// 9. call move constructor, no copy or move, same before and after
+// 10. modify size to decrease, no move or copy, size decrease
+// the test runs twice, once on the default memory and once on a monotonic arena (see VectorResource)
+// and then a benchmark compares the default memory with arenas and pools on many short-lived vectors
+// and another one measures the find throughput (GB/s) on large vectors of int and double
+// the stats of a vector (see VectorStats) are checked against the moves counted by TestItem
 
 constexpr size_t N { 5 };
 
@@ -61,9 +68,13 @@ public:
 class ModifyCapacity : public AVT {
 public:
     void operator()(Vector<TestItem>& V) override {
+        TestItem::reset();
         V.reserve(N);
         stdVector.reserve(N);
         check(V);
+        if (TestItem::s_defaultCount != 0) {
+            throw std::runtime_error("default count != 0");
+        }
         if (V.size() != 0) {
             throw std::runtime_error("size != 0");
         }
@@ -117,6 +128,9 @@ public:
         if (TestItem::s_copyCount != 0) {
             throw std::runtime_error("copy count != 0");
         }
+        if (TestItem::s_defaultCount != 0) {
+            throw std::runtime_error("default count != 0");
+        }
         if (V.size() != 2 * N) {
             throw std::runtime_error("size != 2N");
         }
@@ -126,6 +140,29 @@ public:
     }
 };
 
+class ExpandCapacity : public AVT {
+public:
+    void operator()(Vector<TestItem>& V) override {
+        TestItem::reset();
+        V.reserve(V.capacity() * 4);
+        check(V);
+        std::cout << std::format("expand -> {:c} (default: {}, copy: {}, move: {})", V, 
+            TestItem::s_defaultCount, TestItem::s_copyCount, TestItem::s_moveCount) << std::endl;
+        if (TestItem::s_defaultCount != 0) {
+            throw std::runtime_error("default count != 0");
+        }
+        if (TestItem::s_copyCount != 0) {
+            throw std::runtime_error("copy count != 0");
+        }
+        if (TestItem::s_moveCount != V.size()) {
+            throw std::runtime_error("move count != size");
+        }
+    }
+    std::string type_name() const override {
+        return "Expand Capacity";
+    }
+};
+
 class EraseVector : public AVT {
 public:
     void operator()(Vector<TestItem>& V) override {
@@ -188,6 +225,12 @@ public:
         if (TestItem::s_moveCount != 0) {
             throw std::runtime_error("move count != 0");
         }
+        if (TestItem::s_copyCount != V.size()) {
+            throw std::runtime_error("copy count != size");
+        }
+        if (TestItem::s_defaultCount != 0) {
+            throw std::runtime_error("default count != 0");
+        }
         if (V.size() != V2.size()) {
             throw std::runtime_error("size != size");
         }
@@ -251,6 +294,7 @@ dslab::StructureTestFramework<Vector
     , ModifyCapacity
     , PushBackCopy
     , InsertMove
+    , ExpandCapacity
     , EraseVector
     , FindVector
     , CopyConstructor
@@ -258,10 +302,199 @@ dslab::StructureTestFramework<Vector
     , ModifySize
     > test {};
 
+// each request builds a few short-lived vectors by push_back, and a stack on top of a vector
+// the memory is given back when the request ends
+class RequestProblem : public Algorithm<std::size_t(std::size_t)> {
+protected:
+    static std::size_t request(std::size_t seed) {
+        auto sum { 0uz };
+        for (auto i { 0uz }; i < 16; ++i) {
+            Vector<std::size_t> V {};
+            for (auto j { 0uz }; j < 8 + (seed + i) % 57; ++j) {
+                V.push_back(j);
+            }
+            sum += V.back();
+        }
+        dslab::Stack<std::size_t> S {};
+        for (auto j { 0uz }; j < 100; ++j) {
+            S.push(seed + j);
+        }
+        return sum + S.top();
+    }
+};
+
+class RequestDefault : public RequestProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        auto sum { 0uz };
+        for (auto i { 0uz }; i < n; ++i) {
+            sum += request(i);
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return "Default memory";
+    }
+};
+
+// a fresh arena on a local buffer for every request, nothing is freed until the request ends
+class RequestArena : public RequestProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        auto sum { 0uz };
+        std::byte buffer[1 << 16];
+        for (auto i { 0uz }; i < n; ++i) {
+            std::pmr::monotonic_buffer_resource arena { buffer, sizeof(buffer) };
+            dslab::VectorResource scope { &arena };
+            sum += request(i);
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return "Monotonic arena per request";
+    }
+};
+
+// one pool shared by all the requests
+class RequestPool : public RequestProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        auto sum { 0uz };
+        std::pmr::unsynchronized_pool_resource pool {};
+        dslab::VectorResource scope { &pool };
+        for (auto i { 0uz }; i < n; ++i) {
+            sum += request(i);
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return "Unsynchronized pool";
+    }
+};
+
+dslab::TestFramework<RequestProblem, RequestDefault, RequestArena, RequestPool> benchmark {};
+
+// search for the last element, so the whole vector is scanned
+// the scalar loop is the one Vector::find used before VectorFind, and Vector::find uses SIMD (and threads above the threshold)
+class FindProblem : public Algorithm<std::string(std::size_t)> {};
+
+template <typename T, bool Scalar>
+class FindThroughput : public FindProblem {
+public:
+    std::string operator()(std::size_t n) override {
+        Vector<T> V {};
+        V.resize(n);
+        for (auto i { 0uz }; i < n; ++i) {
+            V[i] = static_cast<T>(i % 1000);
+        }
+        V[n - 1] = static_cast<T>(-1);
+        constexpr auto rounds { 10uz };
+        auto pos { 0uz };
+        auto start { std::chrono::steady_clock::now() };
+        for (auto k { 0uz }; k < rounds; ++k) {
+            if constexpr (Scalar) {
+                auto it { V.begin() };
+                while (it != V.end() && !(*it == V[n - 1])) {
+                    ++it;
+                }
+                pos += std::distance(V.begin(), it);
+            } else {
+                pos += std::distance(V.begin(), V.find(V[n - 1]));
+            }
+        }
+        std::chrono::duration<double> time { std::chrono::steady_clock::now() - start };
+        if (pos != rounds * (n - 1)) {
+            throw std::runtime_error("find error");
+        }
+        return std::format("{:6.2f} GB/s", rounds * n * sizeof(T) / time.count() / 1e9);
+    }
+    std::string type_name() const override {
+        return std::format("Find {:<6} {}", std::is_same_v<T, int> ? "int" : "double", Scalar ? "scalar loop" : "Vector::find");
+    }
+};
+
+dslab::TestFramework<FindProblem,
+    FindThroughput<int, true>, FindThroughput<int, false>,
+    FindThroughput<double, true>, FindThroughput<double, false>> findBenchmark {};
+
+void checkStats() {
+    TestItem::reset();
+    dslab::Vector<TestItem, dslab::VectorAllocatorGP<std::ratio<2>>, dslab::VectorMemory, dslab::VectorStats> V {};
+    for (auto i { 0uz }; i < 1000; ++i) {
+        V.push_back(TestItem { i });
+    }
+    // each push_back moves the new element once
+    if (V.stats().m_movedElements != TestItem::s_moveCount - 1000) {
+        throw std::runtime_error("stats error");
+    }
+    std::cout << format("stats -> {:e4slr}", V) << std::endl;
+}
+
+// a vector assigned in a VectorResource scope keeps its own resource, so it outlives the arena of the scope
+void checkResource() {
+    Vector<int> keep { 1, 2, 3 };
+    {
+        std::pmr::monotonic_buffer_resource arena {};
+        dslab::VectorResource scope { &arena };
+        Vector<int> tmp { 4, 5, 6, 7 };
+        keep = tmp;
+        keep = std::move(tmp);
+        keep = { 8, 9 };
+        tmp = keep;
+    }
+    if (keep.resource() != nullptr || keep.size() != 2 || keep[0] != 8 || keep[1] != 9) {
+        throw std::runtime_error("resource error");
+    }
+    keep.push_back(10);
+}
+
+// moving into a vector on another resource allocates, so a full arena throws bad_alloc through the wrappers too,
+// and both vectors keep their elements
+void checkCrossMove() {
+    dslab::DefaultFinalVector<int> source(100);
+    dslab::Stack<int> stackSource { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 };
+    std::byte buffer[64];
+    std::pmr::monotonic_buffer_resource arena { buffer, sizeof(buffer), std::pmr::null_memory_resource() };
+    dslab::VectorResource scope { &arena };
+    dslab::DefaultFinalVector<int> target { 1, 2 };
+    dslab::Stack<int> stackTarget { 1, 2 };
+    auto failed { 0 };
+    try {
+        target = std::move(source);
+    } catch (const std::bad_alloc&) {
+        ++failed;
+    }
+    try {
+        stackTarget = std::move(stackSource);
+    } catch (const std::bad_alloc&) {
+        ++failed;
+    }
+    if (failed != 2 || target.size() != 2 || source.size() != 100 || stackTarget.size() != 2 || stackSource.size() != 17) {
+        throw std::runtime_error("cross-resource move error");
+    }
+}
+
 int main() {
     Vector<TestItem> V {};
     test.initialize();
     test(V);
+    {
+        std::pmr::monotonic_buffer_resource arena {};
+        dslab::VectorResource scope { &arena };
+        Vector<TestItem> W {};
+        test(W);
+    }
+    checkStats();
+    checkResource();
+    checkCrossMove();
     std::cout << "All tests passed!" << std::endl;
+    for (auto n : { 1'000uz, 100'000uz }) {
+        std::cout << std::format("requests = {}", n) << std::endl;
+        benchmark(n);
+    }
+    for (auto n : { 1'000'000uz, 50'000'000uz }) {
+        std::cout << std::format("find n = {}", n) << std::endl;
+        findBenchmark(n);
+    }
     return 0;
 };
\ No newline at end of file
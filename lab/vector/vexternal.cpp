@@ -0,0 +1,92 @@
+#include "sort.hpp"
+#include "vector.hpp"
+#include <filesystem>
+
+using namespace dslab;
+
+// sort vector files of random 64-bit keys, 2 to 10 times larger than the memory given to ExternalSort,
+// with QuickSort and with RadixSort for the runs, and report the passes and the throughput:
+// the bytes of the file sorted per second, and the bytes read and written per second (two per byte and pass)
+// usage: vexternal [memory in MiB] [directory of the files]
+// the memory is 64 MiB by default, so the files fit in the page cache; give it more than a tenth of the RAM
+// (and a directory on the disk to test) to measure files that do not fit in memory
+
+auto directory { std::filesystem::temp_directory_path() };
+
+template <template <typename, template<typename> typename> typename Sort>
+void test(std::size_t memory, const std::string& input, const std::string& output) {
+    ExternalSort<std::uint64_t, Sort> sorter { memory, directory };
+    ExternalSortStats stats {};
+    auto time { reportProcedureTime([&] { stats = sorter(input, output); }) };
+#ifdef __linux__
+    MappedVector<std::uint64_t> V { output };
+#else
+    // MappedVector is Linux only, elsewhere the output is read back into memory
+    DefaultVector<std::uint64_t> V {};
+    VectorFile::load(output, V);
+#endif
+    if (V.size() != stats.m_size || !std::is_sorted(V.begin(), V.end())) {
+        throw std::runtime_error(sorter.type_name() + " failed");
+    }
+    auto mb { static_cast<double>(stats.m_bytes) / 1e6 };
+    std::cout << std::format("TEST [{:50}] runs {:4}, fan-in {:4}, passes {}, Time: {:.3f} s, {:.1f} MB/s, I/O {:.1f} MB/s",
+        sorter.type_name(), stats.m_runs, stats.m_fanIn, stats.m_passes, time, mb / time, 2 * stats.m_passes * mb / time) << std::endl;
+}
+
+// a comparator is passed to the runs and to the merge (the file makes 3 runs at the least memory),
+// and refused with a Sort that would ignore it (RadixSort sorts by the key)
+void checkComparator() {
+    static_assert(!std::invocable<ExternalSort<std::uint64_t, RadixSort>&, std::string, std::string, std::greater<std::uint64_t>>);
+    static_assert(!std::invocable<RadixSort<int, DefaultVector>&, DefaultVector<int>&, std::greater<int>>);
+    static_assert(std::invocable<RadixSort<int, DefaultVector>&, DefaultVector<int>&>);
+    auto input { (directory / "dslab-vexternal-cmp-in.vec").string() };
+    auto output { (directory / "dslab-vexternal-cmp-out.vec").string() };
+    DefaultVector<std::uint64_t> V(1'000'000);
+    for (auto& x : V) {
+        x = Random::get(100);
+    }
+    VectorFile::save(input, V);
+    ExternalSort<std::uint64_t, QuickSort> sorter { 0, directory };
+    sorter(input, output, std::greater<std::uint64_t>());
+    VectorFile::load(output, V);
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+    if (V.size() != 1'000'000 || !std::is_sorted(V.begin(), V.end(), std::greater<std::uint64_t>())) {
+        throw std::runtime_error("ExternalSort ignored the comparator");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto memory { (argc > 1 ? std::stoul(argv[1]) : 64uz) << 20 };
+    if (argc > 2) {
+        directory = argv[2];
+    }
+    checkComparator();
+    auto input { (directory / "dslab-vexternal-in.vec").string() };
+    auto output { (directory / "dslab-vexternal-out.vec").string() };
+    for (auto times : { 2uz, 4uz, 10uz }) {
+        // written a block at a time, so the input never has to fit in memory
+        auto n { times * memory / sizeof(std::uint64_t) };
+        {
+            std::ofstream out { input, std::ios::binary | std::ios::trunc };
+            auto h { VectorFile::header<std::uint64_t>(n, n) };
+            char head[VectorFile::HEADER_SIZE] {};
+            std::memcpy(head, &h, sizeof(h));
+            out.write(head, VectorFile::HEADER_SIZE);
+            std::vector<std::uint64_t> block(1uz << 17);
+            for (auto i { 0uz }; i < n; i += block.size()) {
+                auto k { std::min(block.size(), n - i) };
+                for (auto j { 0uz }; j < k; ++j) {
+                    block[j] = Random::get();
+                }
+                out.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(k * sizeof(std::uint64_t)));
+            }
+        }
+        std::cout << std::format("file of {} MiB, {} times the memory", (n * sizeof(std::uint64_t)) >> 20, times) << std::endl;
+        test<QuickSort>(memory, input, output);
+        test<RadixSort>(memory, input, output);
+    }
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+    return 0;
+}
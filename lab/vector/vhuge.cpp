@@ -0,0 +1,114 @@
+#include "vector.hpp"
+#include <numeric>
+
+using namespace dslab;
+
+// large vectors on the default memory (VectorMemory) and on huge pages (VectorHugeMemory)
+// on the default memory, resize writes the zeros and every 4 KiB page faults in on first touch,
+// and random accesses miss the TLB once the vector is much larger than the TLB reach
+// note: the huge pages are transparent huge pages unless some are reserved in /proc/sys/vm/nr_hugepages,
+// and /sys/kernel/mm/transparent_hugepage/enabled has to be "always" or "madvise"
+
+template <typename M>
+using HugeVector = Vector<int, VectorAllocatorGP<std::ratio<3, 2>>, M>;
+
+class HugeProblem : public Algorithm<std::size_t(std::size_t)> {};
+
+template <typename M>
+class HugeName {
+public:
+    static std::string name(std::string_view workload) {
+        if constexpr (std::is_same_v<M, VectorHugeMemory>) {
+            return std::format("{:<16} Huge pages", workload);
+        } else {
+            return std::format("{:<16} Default", workload);
+        }
+    }
+};
+
+// resize to n (zero-filled) and sum the elements
+template <typename M>
+class HugeResize : public HugeProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        HugeVector<M> V;
+        V.resize(n);
+        return std::accumulate(V.begin(), V.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return HugeName<M>::name("Resize + sum");
+    }
+};
+
+// push n elements to the back one by one
+template <typename M>
+class HugePush : public HugeProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        HugeVector<M> V;
+        for (auto i { 0uz }; i < n; ++i) {
+            V.push_back(static_cast<int>(i));
+        }
+        return V.size();
+    }
+    std::string type_name() const override {
+        return HugeName<M>::name("Push back");
+    }
+};
+
+// fill the vector, and read n elements at random positions
+template <typename M>
+class HugeGather : public HugeProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        HugeVector<M> V;
+        V.resize(n);
+        std::iota(V.begin(), V.end(), 0);
+        auto sum { 0uz }, x { 1uz };
+        for (auto i { 0uz }; i < n; ++i) {
+            x = x * 6364136223846793005uz + 1442695040888963407uz;
+            sum += V[(x >> 20) % n];
+        }
+        return sum;
+    }
+    std::string type_name() const override {
+        return HugeName<M>::name("Random gather");
+    }
+};
+
+// fill the vector, then shrink it to a tenth and fill it again
+template <typename M>
+class HugeShrink : public HugeProblem {
+public:
+    std::size_t operator()(std::size_t n) override {
+        HugeVector<M> V;
+        V.resize(n);
+        std::iota(V.begin(), V.end(), 0);
+        V.resize(n / 10);
+        V.resize(n);
+        return std::accumulate(V.begin(), V.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return HugeName<M>::name("Shrink + regrow");
+    }
+};
+
+TestFramework<HugeProblem,
+    HugeResize<VectorMemory>,
+    HugeResize<VectorHugeMemory>,
+    HugePush<VectorMemory>,
+    HugePush<VectorHugeMemory>,
+    HugeGather<VectorMemory>,
+    HugeGather<VectorHugeMemory>,
+    HugeShrink<VectorMemory>,
+    HugeShrink<VectorHugeMemory>> test;
+
+std::vector testData { 1'000'000, 10'000'000, 100'000'000 };
+
+int main() {
+    for (auto n : testData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        test(n);
+    }
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include "vector.hpp"
+#include "../fixtures.hpp"
+#include <fstream>
 
 using namespace dslab;
 
@@ -8,7 +10,7 @@ public:
 };
 
 template <typename V>
-    requires std::is_base_of_v<AbstractVector<std::size_t>, V>
+    requires std::is_base_of_v<AbstractVector<typename V::value_type>, V>
 class VectorInsert : public VectorInsertProblem {
     V v;
 public:
@@ -19,16 +21,16 @@ public:
         return v.capacity();
     }
     void reset() override {
-        v.clear();
+        v = {};
     }
 };
 
-template <typename A>
+template <typename A, typename T = std::size_t>
     requires std::is_base_of_v<VectorAllocator, A>
-class VectorInsertImpl : public VectorInsert<Vector<std::size_t, A>> {
+class VectorInsertImpl : public VectorInsert<Vector<T, A>> {
 public:
     std::string type_name() const override {
-        return std::format("Expand with {}", A {}.type_name());
+        return std::format("Expand with {} ({})", A {}.type_name(), is_trivially_relocatable_v<T> ? "realloc" : "move");
     }
 };
 
@@ -36,10 +38,121 @@ std::vector testData { 20'0000, 40'0000, 60'0000, 80'0000, 100'0000 };
 
 TestFramework<VectorInsertProblem,
     VectorInsertImpl<VectorAllocatorAP<64>>,
+    VectorInsertImpl<VectorAllocatorAP<64>, PinnedItem>,
     VectorInsertImpl<VectorAllocatorAP<4096>>,
+    VectorInsertImpl<VectorAllocatorAP<4096>, PinnedItem>,
     VectorInsertImpl<VectorAllocatorGP<std::ratio<3, 2>>>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<3, 2>>, PinnedItem>,
     VectorInsertImpl<VectorAllocatorGP<std::ratio<2>>>,
-    VectorInsertImpl<VectorAllocatorGP<std::ratio<4>>>> test;
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<2>>, PinnedItem>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<4>>>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<4>>, PinnedItem>> test;
+
+// at this scale an arithmetic progression only finishes if the block is remapped instead of copied
+std::vector largeTestData { 1'0000'0000 };
+
+TestFramework<VectorInsertProblem,
+    VectorInsertImpl<VectorAllocatorAP<4096>>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<3, 2>>>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<3, 2>>, PinnedItem>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<2>>>,
+    VectorInsertImpl<VectorAllocatorGP<std::ratio<2>>, PinnedItem>> largeTest;
+
+// bursts of the same final size, and a slow trickle, for the geometric policies and the adaptive one
+// (an arithmetic progression copies too much at this scale, see above)
+// the elements are pinned, so every reallocation copies them and the old and the new block are both resident
+// the result is the number of reallocations, the bytes they move, the spare capacity at the end,
+// and the peak resident set size (Linux only)
+
+// writing 5 to clear_refs resets the peak to the current resident set size
+void resetPeakRss() {
+    std::ofstream { "/proc/self/clear_refs" } << "5";
+}
+
+std::size_t peakRss() {
+    std::ifstream in { "/proc/self/status" };
+    for (std::string line; std::getline(in, line);) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stoull(line.substr(6)) / 1024;
+        }
+    }
+    return 0;
+}
+
+class PolicyProblem : public Algorithm<std::string(std::size_t)> {};
+
+template <typename A, typename T = PinnedItem>
+class PolicyWorkload : public PolicyProblem {
+protected:
+    using V = Vector<T, CountingAllocator<A>>;
+    // return the spare capacity of the last vector, in bytes
+    virtual std::size_t run(std::size_t n) = 0;
+public:
+    std::string operator()(std::size_t n) override {
+        CountingAllocator<A>::s_count = 0;
+        CountingAllocator<A>::s_moved = 0;
+        resetPeakRss();
+        auto spare { run(n) };
+        return std::format("reallocs {:>5}, moved {:>5} MiB, spare {:>6} KiB, peak RSS {:>4} MiB",
+            CountingAllocator<A>::s_count, CountingAllocator<A>::s_moved * sizeof(T) >> 20, spare >> 10, peakRss());
+    }
+};
+
+// build 10 vectors of n elements one after another, as fast as possible
+template <typename A>
+class Burst : public PolicyWorkload<A> {
+protected:
+    std::size_t run(std::size_t n) override {
+        auto spare { 0uz };
+        for (auto k { 0uz }; k < 10; ++k) {
+            typename PolicyWorkload<A>::V v {};
+            for (auto i { 0uz }; i < n; ++i) {
+                v.push_back(i);
+            }
+            spare = (v.capacity() - v.size()) * sizeof(PinnedItem);
+        }
+        return spare;
+    }
+public:
+    std::string type_name() const override {
+        return std::format("Burst   {}", A {}.type_name());
+    }
+};
+
+// build one vector of n elements, with some work before each element
+template <typename A>
+class Trickle : public PolicyWorkload<A> {
+protected:
+    std::size_t run(std::size_t n) override {
+        typename PolicyWorkload<A>::V v {};
+        auto x { 1uz };
+        for (auto i { 0uz }; i < n; ++i) {
+            for (auto j { 0 }; j < 200; ++j) {
+                x = x * 6364136223846793005uz + 1442695040888963407uz;
+            }
+            v.push_back(x);
+        }
+        return (v.capacity() - v.size()) * sizeof(PinnedItem);
+    }
+public:
+    std::string type_name() const override {
+        return std::format("Trickle {}", A {}.type_name());
+    }
+};
+
+// the two workloads keep separate histories
+struct BurstTag {};
+struct TrickleTag {};
+
+TestFramework<PolicyProblem,
+    Burst<VectorAllocatorGP<std::ratio<3, 2>>>,
+    Burst<VectorAllocatorGP<std::ratio<2>>>,
+    Burst<VectorAllocatorAdaptive<BurstTag>>,
+    Trickle<VectorAllocatorGP<std::ratio<3, 2>>>,
+    Trickle<VectorAllocatorGP<std::ratio<2>>>,
+    Trickle<VectorAllocatorAdaptive<TrickleTag>>> policyTest;
+
+std::vector policyTestData { 1'000'000, 10'000'000 };
 
 int main() {
     for (auto n : testData) {
@@ -47,5 +160,14 @@ int main() {
         test.run(&VectorInsertProblem::reset);
         test(n);
     }
+    for (auto n : largeTestData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        largeTest.run(&VectorInsertProblem::reset);
+        largeTest(n);
+    }
+    for (auto n : policyTestData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        policyTest(n);
+    }
     return 0;
-}
\ No newline at end of file
+}
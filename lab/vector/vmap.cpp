@@ -0,0 +1,114 @@
+#include "vector.hpp"
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+using namespace dslab;
+
+// load a dataset of n integers before using it
+// - parse it from a text file (one number per line) into a vector
+// - read a vector file (see VectorFile) into a vector, one copy of the bytes
+// - map the vector file (see MappedVector), nothing is copied and the pages come from the page cache (Linux only)
+// each run sums the elements after loading, so all of them are touched once
+
+auto textPath { (std::filesystem::temp_directory_path() / "dslab-vmap.txt").string() };
+auto filePath { (std::filesystem::temp_directory_path() / "dslab-vmap.vec").string() };
+
+class LoadProblem : public Algorithm<std::size_t(std::size_t)> {};
+
+class LoadText : public LoadProblem {
+public:
+    std::size_t operator()(std::size_t) override {
+        std::ifstream in { textPath };
+        DefaultVector<int> V {};
+        for (int x; in >> x;) {
+            V.push_back(x);
+        }
+        return std::accumulate(V.begin(), V.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return "Parse text";
+    }
+};
+
+class LoadFile : public LoadProblem {
+public:
+    std::size_t operator()(std::size_t) override {
+        DefaultVector<int> V {};
+        VectorFile::load(filePath, V);
+        return std::accumulate(V.begin(), V.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return "Read vector file";
+    }
+};
+
+// MappedVector is Linux only, elsewhere only the two copies are compared
+#ifdef __linux__
+class LoadMapped : public LoadProblem {
+public:
+    std::size_t operator()(std::size_t) override {
+        MappedVector<int> V { filePath };
+        return std::accumulate(V.begin(), V.end(), 0uz);
+    }
+    std::string type_name() const override {
+        return "Map vector file";
+    }
+};
+
+TestFramework<LoadProblem, LoadText, LoadFile, LoadMapped> test;
+
+// the changes of a copy-on-write vector reach the file only by write_back, those of a shared vector always do
+void checkModes() {
+    auto path { (std::filesystem::temp_directory_path() / "dslab-vmap-modes.vec").string() };
+    {
+        auto V { MappedVector<int>::create(path) };
+        for (auto i { 0 }; i < 100; ++i) {
+            V.push_back(i);
+        }
+    }
+    {
+        MappedVector<int> V { path, MapMode::CopyOnWrite };
+        V[0] = -1;
+        V.erase(V.begin() + 1);
+        if (MappedVector<int> { path }[0] != 0) {
+            throw std::runtime_error("copy-on-write vector changed the file");
+        }
+        V.insert(V.end(), 1000, 7);
+        V.write_back();
+    }
+    MappedVector<int> V { path };
+    if (V.size() != 1099 || V[0] != -1 || V[1] != 2 || V.back() != 7 || V.find(98) != V.begin() + 97) {
+        throw std::runtime_error("write back error");
+    }
+    std::cout << std::format("{}: {:s}", V.type_name(), V) << std::endl;
+    std::filesystem::remove(path);
+}
+#else
+TestFramework<LoadProblem, LoadText, LoadFile> test;
+#endif
+
+std::vector testData { 100'000, 1'000'000, 10'000'000 };
+
+int main() {
+#ifdef __linux__
+    checkModes();
+#endif
+    for (auto n : testData) {
+        {
+            DefaultVector<int> V {};
+            V.resize(n);
+            std::iota(V.begin(), V.end(), 0);
+            std::ofstream out { textPath };
+            for (auto x : V) {
+                out << x << '\n';
+            }
+            VectorFile::save(filePath, V);
+        }
+        std::cout << std::format("n = {}", n) << std::endl;
+        test(n);
+    }
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(filePath);
+    return 0;
+}
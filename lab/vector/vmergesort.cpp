@@ -1,6 +1,7 @@
 #include "sort.hpp"
 #include "vector.hpp"
 #include <numeric>
+#include <thread>
 
 using namespace dslab;
 
@@ -8,8 +9,8 @@ template <typename T, template<typename> typename L>
 class MergeSortLimit : public MergeSort<T, L> {
 protected:
     using MergeSort<T, L>::mergeSort;
-    using MergeSort<T, L>::cmp;
-    void sort(L<T>& V) override {
+    using Comparator = typename MergeSort<T, L>::Comparator;
+    void sort(L<T>& V, const Comparator& cmp) override {
         auto mi { --V.end() };
         while (mi != V.begin() && cmp(*(mi - 1), *mi)) {
             --mi;
@@ -17,7 +18,9 @@ protected:
         if (mi == V.begin()) return;
         auto max_left { *std::max_element(V.begin(), mi) };
         auto left { std::lower_bound(mi, V.end(), max_left, cmp) };
-        mergeSort(V.begin(), left, std::distance(V.begin(), left));
+        auto size { static_cast<std::size_t>(std::distance(V.begin(), left)) };
+        Vector<T> W(size / 2);
+        mergeSort(V.begin(), left, size, W.begin(), cmp);
     }
 public:
     std::string type_name() const override {
@@ -29,31 +32,31 @@ template <typename T, template<typename> typename L>
 class MergeSortCond : public AbstractSort<T, L> {
 protected:
     using iterator = typename L<T>::iterator;
-    using AbstractSort<T, L>::cmp;
-    void merge(iterator lo, iterator mi, iterator hi, std::size_t ls) {
-        static Vector<T> W {};
+    using buffer = typename Vector<T>::iterator;
+    using Comparator = typename AbstractSort<T, L>::Comparator;
+    void merge(iterator lo, iterator mi, iterator hi, buffer W, const Comparator& cmp) {
         if (cmp(*(mi - 1), *mi)) return;
-        W.resize(ls);
-        std::move(lo, mi, W.begin());
-        auto i { W.begin() }, j { mi }, k { lo };
-        while (i != W.end() && j != hi) {
+        auto we { std::move(lo, mi, W) };
+        auto i { W }, j { mi }, k { lo };
+        while (i != we && j != hi) {
             if (cmp(*j, *i)) {
                 *k++ = std::move(*j++);
             } else {
                 *k++ = std::move(*i++);
             }
         }
-        std::move(i, W.end(), k);
+        std::move(i, we, k);
     }
-    void mergeSort(iterator lo, iterator hi, std::size_t size) {
+    void mergeSort(iterator lo, iterator hi, std::size_t size, buffer W, const Comparator& cmp) {
         if (size < 2) return;
         auto mi { lo + size / 2 };
-        mergeSort(lo, mi, size / 2);
-        mergeSort(mi, hi, size - size / 2);
-        merge(lo, mi, hi, size / 2);
+        mergeSort(lo, mi, size / 2, W, cmp);
+        mergeSort(mi, hi, size - size / 2, W, cmp);
+        merge(lo, mi, hi, W, cmp);
     }
-    void sort(L<T>& V) override {
-        mergeSort(V.begin(), V.end(), V.size());
+    void sort(L<T>& V, const Comparator& cmp) override {
+        Vector<T> W(V.size() / 2);
+        mergeSort(V.begin(), V.end(), V.size(), W.begin(), cmp);
     }
 
 public:
@@ -66,9 +69,9 @@ template <typename T, template<typename> typename L>
 class MergeSortInplace : public AbstractSort<T, L> {
 protected:
     using iterator = typename L<T>::iterator;
-    using AbstractSort<T, L>::cmp;
+    using Comparator = typename AbstractSort<T, L>::Comparator;
     Vector<T> W;
-    void merge(iterator lo, iterator mi, iterator hi, iterator tmp) {
+    void merge(iterator lo, iterator mi, iterator hi, iterator tmp, const Comparator& cmp) {
         std::swap_ranges(lo, mi, tmp);
         auto i { tmp }, j { mi }, k { lo }, te { tmp + std::distance(lo, mi) };
         while (i != te && j != hi) {
@@ -85,21 +88,21 @@ protected:
             std::iter_swap(k++, j++);
         }
     }
-    void mergesort(iterator lo, iterator hi) {
+    void mergesort(iterator lo, iterator hi, const Comparator& cmp) {
     	if (std::distance(lo, hi) < 2) return;
         auto mi2 { hi - std::distance(lo, hi) / 2 };
-        mergesort(mi2, hi);
+        mergesort(mi2, hi, cmp);
         while (std::distance(lo, mi2) > 1) {
             auto mi1 { mi2 - std::distance(lo, mi2) / 2 };
-            mergesort(mi1, mi2);
-            merge(mi1, mi2, hi, lo);
+            mergesort(mi1, mi2, cmp);
+            merge(mi1, mi2, hi, lo, cmp);
             mi2 = mi1;
         }
-        merge(lo, mi2, hi, W.begin());
+        merge(lo, mi2, hi, W.begin(), cmp);
     }
-    void sort(L<T>& V) override {
+    void sort(L<T>& V, const Comparator& cmp) override {
     	W.resize(1);
-        mergesort(V.begin(), V.end());
+        mergesort(V.begin(), V.end(), cmp);
     }
 public:
     std::string type_name() const override {
@@ -150,15 +153,67 @@ std::vector<std::pair<std::size_t, std::size_t>> testCases {
     {900000, 1000000}
 };
 
+// inputs that arrive (partially) in order
+std::vector<std::pair<std::string, std::function<void(Vector<int>&)>>> orderedCases {
+    { "sorted", [](Vector<int>&) {} },
+    { "reversed", [](Vector<int>& V) { std::reverse(V.begin(), V.end()); } },
+    { "nearly sorted (1% of the elements swapped)", [](Vector<int>& V) {
+        for (auto i { 0uz }; i < V.size() / 200; ++i) {
+            std::swap(V[Random::get(V.size() - 1)], V[Random::get(V.size() - 1)]);
+        }
+    } },
+    { "100 sorted runs", [](Vector<int>& V) {
+        for (auto i { 0uz }; i < V.size(); ++i) {
+            V[i] = static_cast<int>(i % (V.size() / 100));
+        }
+    } }
+};
+
 TestFramework<MergeSortTest<int>,
     MergeSortTestImpl<int, MergeSort>,
     MergeSortTestImpl<int, MergeSortUpward>,
     MergeSortTestImpl<int, MergeSortLimit>,
     MergeSortTestImpl<int, MergeSortInplace>,
-    MergeSortTestImpl<int, MergeSortCond>
+    MergeSortTestImpl<int, MergeSortCond>,
+    MergeSortTestImpl<int, TimSort>
 	> test;
 
+// one sorter shared by several threads, each sorting its own vector, half of them with their own comparator
+template <template<typename, template<typename> typename> typename Sort>
+void checkConcurrent() {
+    Sort<int, DefaultVector> sorter {};
+    std::vector<DefaultVector<int>> vectors(4);
+    for (auto& V : vectors) {
+        V.resize(100'000);
+        std::iota(V.begin(), V.end(), 0);
+        std::shuffle(V.begin(), V.end(), Random::engine());
+    }
+    {
+        std::vector<std::jthread> threads {};
+        for (auto i { 0uz }; i < vectors.size(); ++i) {
+            threads.emplace_back([&sorter, &V = vectors[i], i] {
+                if (i % 2 == 0) {
+                    sorter(V);
+                } else {
+                    sorter(V, std::greater<int>());
+                }
+            });
+        }
+    }
+    for (auto i { 0uz }; i < vectors.size(); ++i) {
+        auto sorted { i % 2 == 0
+            ? std::is_sorted(vectors[i].begin(), vectors[i].end())
+            : std::is_sorted(vectors[i].begin(), vectors[i].end(), std::greater<int>()) };
+        if (!sorted) {
+            throw std::runtime_error(std::format("{} is not sorted when shared by threads", sorter.type_name()));
+        }
+    }
+}
+
 int main() {
+    checkConcurrent<MergeSort>();
+    checkConcurrent<MergeSortUpward>();
+    checkConcurrent<TimSort>();
     for (Vector<int> V(N); auto [lo, hi] : testCases) {
         std::cout << std::format("Testing range [{:>6}, {:>6})", lo, hi) << std::endl;
         std::iota(V.begin(), V.end(), 0);
@@ -166,5 +221,12 @@ int main() {
         test.run([&V](auto& test) { test.initialize(V); });
         test();
     }
+    for (Vector<int> V(N); const auto& [name, arrange] : orderedCases) {
+        std::cout << std::format("Testing {}", name) << std::endl;
+        std::iota(V.begin(), V.end(), 0);
+        arrange(V);
+        test.run([&V](auto& test) { test.initialize(V); });
+        test();
+    }
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "sort.hpp"
+#include "vector.hpp"
+#include <thread>
+
+using namespace dslab;
+
+// sort a shuffled permutation with ParallelMergeSort on 1, 2, 4, ... threads (up to the number of cores),
+// and report the speedup over MergeSort (single-threaded) and over ParallelMergeSort on one thread
+
+template <typename Sort>
+double sortTime(Sort& sorter, const Vector<int>& V0) {
+    Vector<int> V { V0 };
+    auto time { reportProcedureTime([&] { sorter(V); }) };
+    if (!std::is_sorted(V.begin(), V.end())) {
+        throw std::runtime_error(sorter.type_name() + " failed");
+    }
+    return time;
+}
+
+std::vector testData { 10'000'000uz, 100'000'000uz };
+
+int main() {
+    auto cores { std::max(std::thread::hardware_concurrency(), 1u) };
+    for (auto n : testData) {
+        Vector<int> V0(n);
+        std::iota(V0.begin(), V0.end(), 0);
+        VectorShuffle::shuffle(V0);
+        MergeSort<int, DefaultVector> sequential {};
+        auto base { sortTime(sequential, V0) };
+        std::cout << std::format("n = {}, {}: {:.6f} s", n, sequential.type_name(), base) << std::endl;
+        auto one { 0.0 };
+        for (auto threads { 1uz }; threads <= cores; threads = threads < cores && threads * 2 > cores ? cores : threads * 2) {
+            ParallelMergeSort<int, DefaultVector> sorter { threads };
+            auto time { sortTime(sorter, V0) };
+            if (threads == 1) {
+                one = time;
+            }
+            std::cout << std::format("TEST [{:40}] Time: {:.6f} s, speedup {:.2f} (over 1 thread {:.2f})",
+                sorter.type_name(), time, base / time, one / time) << std::endl;
+        }
+    }
+    return 0;
+}
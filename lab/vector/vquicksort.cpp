@@ -0,0 +1,83 @@
+#include "sort.hpp"
+#include "vector.hpp"
+#include <numeric>
+
+using namespace dslab;
+
+// QuickSort (pdqsort) against MergeSort and TimSort on inputs with and without patterns,
+// and on an input that makes a plain median-of-3 quicksort take quadratic time
+
+template <typename T>
+class SortTest : public Algorithm<bool()> {
+public:
+    virtual void initialize(const Vector<T>& V) = 0;
+};
+
+template <typename T, template <typename, template<typename> typename> typename Sort>
+    requires std::is_base_of_v<AbstractSort<T, DefaultVector>, Sort<T, DefaultVector>>
+class SortTestImpl : public SortTest<T> {
+    Vector<T> V;
+    Sort<T, DefaultVector> sorter;
+
+public:
+    void initialize(const Vector<T>& V) override {
+        this->V = V;
+    }
+
+    bool operator()() override {
+        sorter(V);
+        return std::is_sorted(V.begin(), V.end());
+    }
+
+    std::string type_name() const override {
+        return sorter.type_name();
+    }
+};
+
+// Musser's median-of-3 killer: the median of the first, middle and last elements is always the second smallest
+void medianOf3Killer(Vector<int>& V) {
+    auto n { V.size() };
+    for (auto i { 0uz }; i < n / 2; ++i) {
+        V[i] = static_cast<int>(i % 2 == 0 ? i : n / 2 + i);
+        V[n / 2 + i] = static_cast<int>(2 * i + 1);
+    }
+}
+
+std::vector<std::pair<std::string, std::function<void(Vector<int>&)>>> testCases {
+    { "random", [](Vector<int>& V) { VectorShuffle::shuffle(V); } },
+    { "sorted", [](Vector<int>&) {} },
+    { "reversed", [](Vector<int>& V) { std::reverse(V.begin(), V.end()); } },
+    { "nearly sorted (1% of the elements swapped)", [](Vector<int>& V) {
+        for (auto i { 0uz }; i < V.size() / 200; ++i) {
+            std::swap(V[Random::get(V.size() - 1)], V[Random::get(V.size() - 1)]);
+        }
+    } },
+    { "organ pipe", [](Vector<int>& V) { std::reverse(V.begin() + V.size() / 2, V.end()); } },
+    { "16 distinct values", [](Vector<int>& V) {
+        for (auto& x : V) {
+            x = static_cast<int>(Random::get(15));
+        }
+    } },
+    { "median-of-3 killer", medianOf3Killer }
+};
+
+TestFramework<SortTest<int>,
+    SortTestImpl<int, QuickSort>,
+    SortTestImpl<int, MergeSort>,
+    SortTestImpl<int, TimSort>
+    > test;
+
+std::vector testData { 1'000'000uz, 10'000'000uz };
+
+int main() {
+    for (auto n : testData) {
+        for (Vector<int> V(n); const auto& [name, arrange] : testCases) {
+            std::cout << std::format("n = {}, {}", n, name) << std::endl;
+            std::iota(V.begin(), V.end(), 0);
+            arrange(V);
+            test.run([&V](auto& test) { test.initialize(V); });
+            test();
+        }
+    }
+    return 0;
+}
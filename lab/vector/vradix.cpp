@@ -0,0 +1,106 @@
+#include "sort.hpp"
+#include "vector.hpp"
+
+using namespace dslab;
+
+// sort n random keys with QuickSort and MergeSort, and with RadixSort: LSD with each digit width, and MSD (in place,
+// only for plain keys, a sort by a key extractor stays on the stable LSD path)
+// - std::uint32_t and std::uint64_t keys over their whole range
+// - std::size_t keys below n, a shuffled permutation (the high digits are zero and skipped)
+// - int keys, half of them negative
+// - records sorted by a key extractor
+
+template <typename T, typename Sort>
+double sortTime(Sort& sorter, const Vector<T>& V0, auto less) {
+    Vector<T> V { V0 };
+    auto time { reportProcedureTime([&] { sorter(V); }) };
+    if (!std::is_sorted(V.begin(), V.end(), less)) {
+        throw std::runtime_error(sorter.type_name() + " failed");
+    }
+    return time;
+}
+
+template <typename T, typename Key = std::identity>
+void test(const std::string& name, const Vector<T>& V0, Key key = {}) {
+    auto less { [&](const T& x, const T& y) { return key(x) < key(y); } };
+    auto report { [&](const std::string& sorter, double time) {
+        std::cout << std::format("TEST [{:40}] Time: {:.6f} s", sorter, time) << std::endl;
+    } };
+    std::cout << std::format("n = {}, {}", V0.size(), name) << std::endl;
+    QuickSort<T, DefaultVector> quick {};
+    MergeSort<T, DefaultVector> merge {};
+    report(quick.type_name(), sortTime(quick, V0, less));
+    report(merge.type_name(), sortTime(merge, V0, less));
+    for (auto bits : { 0uz, 8uz, 11uz, 16uz }) {
+        RadixSort<T, DefaultVector, Key> radix { key, bits, std::thread::hardware_concurrency(), V0.size() + 1 };
+        report(radix.type_name() + (bits == 0 ? " (LSD)" : ""), sortTime(radix, V0, less));
+    }
+    if constexpr (std::is_same_v<Key, std::identity>) {
+        RadixSort<T, DefaultVector, Key> msd { key, 0, std::thread::hardware_concurrency(), 0 };
+        report(msd.type_name() + " (MSD)", sortTime(msd, V0, less));
+    }
+}
+
+struct Record {
+    std::uint32_t m_key;
+    std::uint32_t m_value;
+    bool operator==(const Record&) const = default;
+    bool operator<(const Record& other) const {
+        return m_key < other.m_key;
+    }
+};
+
+std::vector testData { 1'000'000uz, 10'000'000uz, 100'000'000uz };
+
+// a sort by a key extractor keeps the order of equal keys, even above the MSD threshold
+void checkStable() {
+    Vector<Record> V(100'000);
+    for (auto i { 0uz }; i < V.size(); ++i) {
+        V[i] = { static_cast<std::uint32_t>(Random::get(99)), static_cast<std::uint32_t>(i) };
+    }
+    auto key { [](const Record& r) { return r.m_key; } };
+    RadixSort<Record, DefaultVector, decltype(key)> sorter { key, 0, std::thread::hardware_concurrency(), 0 };
+    sorter(V);
+    if (!std::is_sorted(V.begin(), V.end(), [](const Record& x, const Record& y) {
+        return x.m_key < y.m_key || (x.m_key == y.m_key && x.m_value < y.m_value);
+    })) {
+        throw std::runtime_error("radix sort by key is not stable");
+    }
+}
+
+int main() {
+    checkStable();
+    for (auto n : testData) {
+        {
+            Vector<std::uint32_t> V(n);
+            Random::fill(std::span { std::to_address(V.begin()), n }, 0u, std::numeric_limits<std::uint32_t>::max());
+            test("std::uint32_t", V);
+        }
+        {
+            Vector<std::uint64_t> V(n);
+            for (auto& x : V) {
+                x = Random::get();
+            }
+            test("std::uint64_t", V);
+        }
+        {
+            Vector<std::size_t> V(n);
+            std::iota(V.begin(), V.end(), 0uz);
+            VectorShuffle::shuffle(V);
+            test("std::size_t permutation", V);
+        }
+        {
+            Vector<int> V(n);
+            Random::fill(std::span { std::to_address(V.begin()), n }, -1'000'000'000, 1'000'000'000);
+            test("int", V);
+        }
+        {
+            Vector<Record> V(n);
+            for (auto i { 0uz }; i < n; ++i) {
+                V[i] = { static_cast<std::uint32_t>(Random::get(std::numeric_limits<std::uint32_t>::max())), static_cast<std::uint32_t>(i) };
+            }
+            test("records by key", V, [](const Record& r) { return r.m_key; });
+        }
+    }
+    return 0;
+}
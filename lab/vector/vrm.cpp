@@ -1,4 +1,5 @@
 #include "vector.hpp"
+#include "compact.hpp"
 
 using namespace dslab;
 
@@ -89,13 +90,27 @@ public:
     }
 };
 
+template <typename T>
+class VectorRemoveCompact : public VectorRemove<T> {
+    using VectorRemove<T>::V;
+protected:
+    void remove(const T& e) override {
+        compact::remove(V, e);
+    }
+public:
+    std::string type_name() const override {
+        return "Global   Find, Batched  Remove (SIMD Compaction)";
+    }
+};
+
 std::vector testData { 10, 100, 1000, 10000, 100'000 };
 
 TestFramework<VectorRemove<int>,
     VectorRemoveBasic<int>,
     VectorRemoveImproved<int>,
     VectorRemoveFSP<int>,
-    VectorRemoveErase<int>> test;
+    VectorRemoveErase<int>,
+    VectorRemoveCompact<int>> test;
 
 int main() {
     for (auto n : testData) {
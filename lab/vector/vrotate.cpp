@@ -65,6 +65,18 @@ public:
     }
 };
 
+// picks one of the algorithms above (or block swaps) by the sizes, see VectorRotate
+template <typename T>
+class CyclicShiftLibrary : public CyclicShift<T> {
+public:
+    void operator()(Vector<T>& V, std::size_t k) override {
+        VectorRotate::rotate(V, k);
+    }
+    std::string type_name() const override {
+        return "Cyclic Shift (VectorRotate)";
+    }
+};
+
 std::vector<std::pair<std::size_t, std::size_t>> testData {
     {10, 2},
     {100'000'000, 1},
@@ -78,7 +90,8 @@ TestFramework<CyclicShift<std::size_t>,
     CyclicShiftStd<std::size_t>,
     CyclicShiftMove<std::size_t>,
     CyclicShiftSwap<std::size_t>,
-    CyclicShiftReverse<std::size_t>> test;
+    CyclicShiftReverse<std::size_t>,
+    CyclicShiftLibrary<std::size_t>> test;
 
 int main() {
     for (auto [n, k] : testData) {
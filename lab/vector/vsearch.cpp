@@ -151,9 +151,9 @@ public:
 template <typename T>
 class BinarySearchTest : public Algorithm<std::size_t(const Vector<T>&, const T&)> {
 public:
-    void initialize(Vector<T>& V, std::size_t n, std::function<T()> random) {
+    void initialize(Vector<T>& V, std::size_t n, const T& lo, const T& hi) {
         V.resize(n);
-        std::generate(V.begin(), V.end(), random);
+        Random::fill(std::span { std::to_address(V.begin()), n }, lo, hi);
         std::sort(V.begin(), V.end());
     }
 };
@@ -180,10 +180,7 @@ public:
 
 std::vector testData { 10, 100, 1000, 10000, 100'000, 1'000'000 };
 
-constexpr std::size_t random() {
-    constexpr std::size_t lo { 0 }, hi { 5 };
-    return Random::get(lo, hi);
-}
+constexpr std::size_t lo { 0 }, hi { 5 };
 
 TestFramework<BinarySearchTest<std::size_t>,
     BinarySearchTestImpl<std::size_t, BinarySearchRecursive>,
@@ -196,8 +193,8 @@ int main() {
     for (Vector<std::size_t> V; auto n : testData) {
         std::cout << std::format("n = {}", n) << std::endl;
         test.run([&V, n](BinarySearchTest<std::size_t>& test) {
-            test.initialize(std::ref(V), n, random);
+            test.initialize(std::ref(V), n, lo, hi);
         });
-        test(std::cref(V), random());
+        test(std::cref(V), Random::get(lo, hi));
     }
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "vector.hpp"
+#include "../fixtures.hpp"
+#include <chrono>
+#include <vector>
+
+using namespace dslab;
+
+// push_back on Vector with the growth policies of lab/vector/vins.cpp, and on SegmentedVector
+// a Vector moves all its elements when it grows (unless the block is remapped), so a single push_back may take
+// as long as copying the whole vector; a SegmentedVector only allocates one more chunk
+// the result is the slowest single push_back, and the time is the total time of all of them
+
+class PushProblem : public Algorithm<std::string(std::size_t)> {};
+
+template <typename V>
+class PushLatency : public PushProblem {
+public:
+    std::string operator()(std::size_t n) override {
+        V v {};
+        auto worst { std::chrono::nanoseconds::zero() };
+        for (auto i { 0uz }; i < n; ++i) {
+            auto start { std::chrono::steady_clock::now() };
+            v.push_back(i);
+            worst = std::max(worst, std::chrono::steady_clock::now() - start);
+        }
+        return std::format("worst push_back {:>9} ns", worst.count());
+    }
+    std::string type_name() const override {
+        return std::format("{} ({})", V {}.type_name(),
+            is_trivially_relocatable_v<typename V::value_type> ? "relocatable" : "pinned");
+    }
+};
+
+// the random access cost of the chunk map
+template <typename V>
+class IndexedSum : public PushProblem {
+public:
+    std::string operator()(std::size_t n) override {
+        V v {};
+        v.resize(n);
+        for (auto i { 0uz }; i < n; ++i) {
+            v[i] = i;
+        }
+        auto sum { 0uz };
+        for (auto k { 0 }; k < 10; ++k) {
+            for (auto i { 0uz }; i < n; ++i) {
+                sum += v[i];
+            }
+        }
+        return std::format("sum {}", sum);
+    }
+    std::string type_name() const override {
+        return std::format("Indexed sum x10 {}", V {}.type_name());
+    }
+};
+
+template <typename A, typename T = std::size_t>
+using VectorWith = Vector<T, A>;
+
+TestFramework<PushProblem,
+    PushLatency<VectorWith<VectorAllocatorAP<4096>>>,
+    PushLatency<VectorWith<VectorAllocatorGP<std::ratio<3, 2>>>>,
+    PushLatency<VectorWith<VectorAllocatorGP<std::ratio<3, 2>>, PinnedItem>>,
+    PushLatency<VectorWith<VectorAllocatorGP<std::ratio<2>>>>,
+    PushLatency<VectorWith<VectorAllocatorGP<std::ratio<2>>, PinnedItem>>,
+    PushLatency<SegmentedVector<std::size_t>>,
+    PushLatency<SegmentedVector<PinnedItem>>,
+    IndexedSum<DefaultVector<std::size_t>>,
+    IndexedSum<SegmentedVector<std::size_t>>> test;
+
+std::vector testData { 100'000, 1'000'000, 10'000'000 };
+
+// random inserts and erases (including empty ranges) across the chunk boundaries, compared with std::vector
+void checkEdits() {
+    SegmentedVector<std::string> v {};
+    std::vector<std::string> w {};
+    for (auto k { 0uz }; k < 20'000; ++k) {
+        auto r { Random::get(w.size()) };
+        auto e { std::format("element {} with a heap buffer", k) };
+        switch (Random::get(3)) {
+        case 0:
+            v.insert(v.begin() + r, e);
+            w.insert(w.begin() + r, e);
+            break;
+        case 1: {
+            auto n { Random::get(40) };
+            v.insert(v.begin() + r, n, e);
+            w.insert(w.begin() + r, n, e);
+            break;
+        }
+        default: {
+            auto n { Random::get(w.size() - r) };
+            v.erase(v.begin() + r, v.begin() + (r + n));
+            w.erase(w.begin() + r, w.begin() + (r + n));
+        }
+        }
+        if (v.size() != w.size() || !std::equal(w.begin(), w.end(), v.begin())) {
+            throw std::runtime_error("segmented vector edit error");
+        }
+    }
+}
+
+int main() {
+    checkEdits();
+    for (auto n : testData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        test(n);
+    }
+    return 0;
+}
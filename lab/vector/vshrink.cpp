@@ -0,0 +1,67 @@
+#include "vector.hpp"
+#include "../fixtures.hpp"
+
+using namespace dslab;
+
+// capacity shrinking with different allocator policies
+// the default policies keep the block, the shrinking policies give memory back once the vector is much emptier
+// a policy that shrinks to the size at once (no gap between growing and shrinking) is added for comparison
+
+// shrink to the size whenever the size drops, and grow by 3/2
+class VectorAllocatorEager : public VectorAllocatorGP<std::ratio<3, 2>> {
+protected:
+    std::size_t shrink(std::size_t, std::size_t size) const override {
+        return size;
+    }
+public:
+    std::string type_name() const override {
+        return "C -> C * 3/2 (shrink to size)";
+    }
+};
+
+class ShrinkProblem : public Algorithm<std::string(std::size_t)> {};
+
+// 1. push n elements
+// 2. pop and push one element alternately n times at the boundary
+// 3. pop all but n / 1000 elements
+template <typename A>
+class ShrinkWorkload : public ShrinkProblem {
+    using Policy = CountingAllocator<A>;
+public:
+    std::string operator()(std::size_t n) override {
+        Policy::s_count = 0;
+        Vector<std::size_t, Policy> V;
+        for (auto i { 0uz }; i < n; ++i) {
+            V.push_back(i);
+        }
+        auto peak { V.capacity() };
+        for (auto i { 0uz }; i < n; ++i) {
+            V.pop_back();
+            V.push_back(i);
+        }
+        while (V.size() > n / 1000) {
+            V.pop_back();
+        }
+        return std::format("realloc {:6}, peak {:9}, final {:9}", Policy::s_count, peak, V.capacity());
+    }
+    std::string type_name() const override {
+        return A {}.type_name();
+    }
+};
+
+TestFramework<ShrinkProblem,
+    ShrinkWorkload<VectorAllocatorGP<std::ratio<3, 2>>>,
+    ShrinkWorkload<VectorAllocatorGPShrink<std::ratio<3, 2>>>,
+    ShrinkWorkload<VectorAllocatorGPShrink<std::ratio<2>>>,
+    ShrinkWorkload<VectorAllocatorAPShrink<4096>>,
+    ShrinkWorkload<VectorAllocatorEager>> test;
+
+std::vector testData { 1'000, 100'000, 1'000'000 };
+
+int main() {
+    for (auto n : testData) {
+        std::cout << std::format("n = {}", n) << std::endl;
+        test(n);
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "vector.hpp"
+#include "compact.hpp"
 
 using namespace dslab;
 
@@ -91,6 +92,17 @@ public:
     }
 };
 
+template <typename T>
+class VectorUniqueHash : public VectorUnique<T> {
+public:
+    void operator()(Vector<T>& V) override {
+        compact::unique_global(V);
+    }
+    std::string type_name() const override {
+        return "Unique globally   (Hash Set, see dslab/compact)";
+    }
+};
+
 template <typename T>
 class VectorUniqueTest : public Algorithm<std::size_t()> {
 protected:
@@ -121,7 +133,8 @@ std::vector testData { 10, 100, 1000, 10000 };
 TestFramework<VectorUniqueTest<int>,
     VectorUniqueTestImpl<int, VectorUniqueBasic>,
     VectorUniqueTestImpl<int, VectorUniqueBasic2>,
-    VectorUniqueTestImpl<int, VectorUniqueSort>> test;
+    VectorUniqueTestImpl<int, VectorUniqueSort>,
+    VectorUniqueTestImpl<int, VectorUniqueHash>> test;
 
 void testCase(std::function<Vector<int>(std::size_t)> generator) {
     for (auto n : testData) {
@@ -132,7 +145,26 @@ void testCase(std::function<Vector<int>(std::size_t)> generator) {
     }
 }
 
+// unique_global on every element size: the small ones index a table, 4 and 8 bytes are hashed by their bits
+// (with -0.0 == 0.0), and long double falls back to std::unordered_set
+template <typename T>
+void checkGlobal() {
+    Vector<T> V { T { 3 }, T { 1 }, T { 3 }, T { 2 }, T { 1 }, T { 0 }, T { 2 } };
+    if constexpr (std::is_floating_point_v<T>) {
+        V.push_back(-T { 0 });
+    }
+    compact::unique_global(V);
+    if (V.size() != 4 || V[0] != T { 3 } || V[1] != T { 1 } || V[2] != T { 2 } || V[3] != T { 0 }) {
+        throw std::runtime_error("unique_global error");
+    }
+}
+
 int main() {
+    checkGlobal<char>();
+    checkGlobal<short>();
+    checkGlobal<int>();
+    checkGlobal<double>();
+    checkGlobal<long double>();
     std::cout << "worst case scenario" << std::endl;
     testCase([](std::size_t n) {
         Vector<int> V(n);